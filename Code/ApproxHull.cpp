@@ -0,0 +1,231 @@
+/*****************************************************************************
+*          Approximate (Bentley-Faust-Preparata) Convex Hull code            *
+*****************************************************************************/
+// Linear time approximate hull for very large inputs. The x range is cut into
+// k vertical strips and only the lowest and highest point of every strip (plus
+// the leftmost and rightmost points) survive. monotoneChain() from IncRand.cpp
+// is then run on those at most 2k+4 survivors.
+// Every input point that falls outside the approximate hull is within
+// (xmax - xmin) / k of it, so raising k trades time for accuracy.
+// Orientation signs come from the exact orient2d() in RobustPredicates.h, so
+// tiny or huge coordinates do not break the hull.
+// To run code open Cmd in folder, type g++ -ffp-contract=off ApproxHull.cpp, run executable.
+// Run the executable with --compare to also compute the exact monotone chain
+// hull (timed separately) and measure the real error against the bound, and/or
+// with --cache to reuse hulls through HullCache.h.
+
+#include <iostream>
+#include <fstream>
+#include <vector>
+#include <string>
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include "RobustPredicates.h"
+#include "HullCache.h"
+using namespace std;
+
+int op_counter = 0;
+
+struct Point {
+    double x, y;
+
+    bool operator==(const Point &other) const {
+        return x == other.x && y == other.y;
+    }
+};
+
+// Exact sign: positive when O, A, B turn counterclockwise
+double cross(const Point &O, const Point &A, const Point &B) {
+    return orient2d(O, A, B);
+}
+
+bool lexLess(const Point &a, const Point &b) {
+    return a.x < b.x || (a.x == b.x && a.y < b.y);
+}
+
+// Andrew's monotone chain convex hull (returns CCW hull without duplicate last point)
+vector<Point> monotoneChain(vector<Point> pts) {
+    if (pts.size() <= 1) return pts;
+    sort(pts.begin(), pts.end(), lexLess);
+    // Remove duplicates post-sort
+    vector<Point> uniq;
+    uniq.reserve(pts.size());
+    for (auto &p : pts) {
+        if (uniq.empty() || !(p == uniq.back())) uniq.push_back(p);
+    }
+    pts.swap(uniq);
+    int n = (int)pts.size();
+    if (n <= 1) return pts;
+
+    vector<Point> lower, upper;
+    for (int i = 0; i < n; ++i) {
+        while (lower.size() >= 2 && cross(lower[lower.size()-2], lower.back(), pts[i]) <= 0)
+            lower.pop_back();
+        lower.push_back(pts[i]);
+    }
+    for (int i = n - 1; i >= 0; --i) {
+        while (upper.size() >= 2 && cross(upper[upper.size()-2], upper.back(), pts[i]) <= 0)
+            upper.pop_back();
+        upper.push_back(pts[i]);
+    }
+    // Concatenate, removing duplicate endpoints
+    lower.pop_back();
+    upper.pop_back();
+    lower.insert(lower.end(), upper.begin(), upper.end());
+    return lower;
+}
+
+// Bentley-Faust-Preparata strip filter followed by monotone chain.
+// 'bound' receives the guaranteed error bound (xmax - xmin) / k.
+vector<Point> approxHull(const vector<Point> &pts, int k, double &bound) {
+    bound = 0;
+    if (pts.size() <= 3 || k < 1) return monotoneChain(pts);
+
+    // Leftmost and rightmost points, ties broken on y so both ends are kept
+    Point minLo = pts[0], minHi = pts[0], maxLo = pts[0], maxHi = pts[0];
+    for (const auto &p : pts) {
+        op_counter++;
+        if (p.x < minLo.x || (p.x == minLo.x && p.y < minLo.y)) minLo = p;
+        if (p.x < minHi.x || (p.x == minHi.x && p.y > minHi.y)) minHi = p;
+        if (p.x > maxLo.x || (p.x == maxLo.x && p.y < maxLo.y)) maxLo = p;
+        if (p.x > maxHi.x || (p.x == maxHi.x && p.y > maxHi.y)) maxHi = p;
+    }
+    double xmin = minLo.x, width = maxLo.x - xmin;
+    if (width <= 0) return monotoneChain({minLo, minHi});
+    bound = width / k;
+
+    // Lowest and highest point in each strip; -1 marks an empty strip
+    vector<int> lo(k, -1), hi(k, -1);
+    for (int i = 0; i < (int)pts.size(); ++i) {
+        int s = (int)((pts[i].x - xmin) / width * k);
+        if (s >= k) s = k - 1;
+        op_counter++;
+        if (lo[s] == -1 || pts[i].y < pts[lo[s]].y) lo[s] = i;
+        if (hi[s] == -1 || pts[i].y > pts[hi[s]].y) hi[s] = i;
+    }
+
+    vector<Point> survivors{minLo, minHi, maxLo, maxHi};
+    survivors.reserve(2 * k + 4);
+    for (int s = 0; s < k; ++s) {
+        if (lo[s] == -1) continue;
+        survivors.push_back(pts[lo[s]]);
+        if (hi[s] != lo[s]) survivors.push_back(pts[hi[s]]);
+    }
+    return monotoneChain(survivors);
+}
+
+// The bound approxHull() reports, for hulls that come from the cache
+double stripBound(const vector<Point> &pts, int k) {
+    if (pts.size() <= 3 || k < 1) return 0;
+    auto ends = minmax_element(pts.begin(), pts.end(), [](const Point &a, const Point &b) { return a.x < b.x; });
+    return (ends.second->x - ends.first->x) / k;
+}
+
+// Distance from p to a CCW convex polygon, 0 if p is inside or on the boundary
+double distanceToHull(const vector<Point> &hull, const Point &p) {
+    int n = (int)hull.size();
+    if (n == 0) return 0;
+    if (n == 1) return hypot(p.x - hull[0].x, p.y - hull[0].y);
+
+    bool inside = n >= 3;
+    double best = INFINITY;
+    for (int i = 0; i < n; ++i) {
+        const Point &a = hull[i], &b = hull[(i + 1) % n];
+        if (cross(a, b, p) < 0) inside = false;
+        // distance from p to segment ab
+        double dx = b.x - a.x, dy = b.y - a.y;
+        double len2 = dx * dx + dy * dy;
+        double t = len2 > 0 ? ((p.x - a.x) * dx + (p.y - a.y) * dy) / len2 : 0;
+        t = max(0.0, min(1.0, t));
+        best = min(best, hypot(p.x - (a.x + t * dx), p.y - (a.y + t * dy)));
+    }
+    return inside ? 0 : best;
+}
+
+// Read points from CSV
+vector<Point> readPoints(const string &filename) {
+    ifstream fin(filename);
+    vector<Point> pts;
+    if (!fin) { cerr << "Cannot open file: " << filename << endl; return pts; }
+    double x, y; char comma;
+    while (fin >> x >> comma >> y) pts.push_back({x, y});
+    return pts;
+}
+
+int main(int argc, char* argv[]) {
+    string filename;
+    int k;
+    cout << "Enter input .txt file: ";
+    cin >> filename;
+    cout << "Number of strips (k): ";
+    cin >> k;
+    if (!cin || k < 1) { cerr << "k must be a positive integer\n"; return 1; }
+
+    vector<Point> points = readPoints(filename);
+    if (points.empty()) return 1;
+
+    bool compare = find(argv + 1, argv + argc, string("--compare")) != argv + argc;
+    // the strip count changes the result, so it is part of the engine's key
+    double limitMB = cacheLimitMB(argc, argv);
+    HullCache approxCache("approx-k" + to_string(k), "orient2d", limitMB);
+    HullCache exactCache("monotone", "orient2d", limitMB);
+
+    double bound;
+    vector<Point> hull;
+    auto start = chrono::high_resolution_clock::now();
+    bool cached = approxCache.lookup(points, hull);
+    auto computeStart = chrono::high_resolution_clock::now();
+    if (cached) bound = stripBound(points, k);
+    else hull = approxHull(points, k, bound);
+    auto end = chrono::high_resolution_clock::now();
+    chrono::duration<double> elapsed = end - start;
+    int approxOps = cached ? (int)approxCache.operations() : op_counter;
+    if (!cached) approxCache.store(hull, chrono::duration<double>(end - computeStart).count(), approxOps);
+
+    // Exact hull for comparison; the farthest outside point is always an exact hull vertex.
+    // O(n log n), so only on request.
+    vector<Point> exact;
+    chrono::duration<double> exactElapsed{0};
+    double measured = 0;
+    if (compare) {
+        auto exactStart = chrono::high_resolution_clock::now();
+        bool exactCached = exactCache.lookup(points, exact);
+        auto exactComputeStart = chrono::high_resolution_clock::now();
+        if (!exactCached) exact = monotoneChain(points);
+        auto exactEnd = chrono::high_resolution_clock::now();
+        exactElapsed = exactEnd - exactStart;
+        if (!exactCached) exactCache.store(exact, chrono::duration<double>(exactEnd - exactComputeStart).count(), 0);
+        for (const auto &p : exact) measured = max(measured, distanceToHull(hull, p));
+    }
+
+    string outFile = "Approx_Results_" + filename;
+    ofstream fout(outFile);
+    if (!fout) { cerr << "Failed to open " << outFile << " for writing\n"; return 1; }
+
+    fout << hull.size() << " point hull size.\n";
+    fout << "The Algorithm made " << approxOps << " operations.\n";
+    fout << "The size of the array was " << points.size() << ".\n";
+    fout << "Hull computation time: " << elapsed.count() << " seconds\n";
+    fout << "Strips (k): " << k << "\n";
+    fout << "Guaranteed error bound: " << bound << "\n";
+    if (compare) {
+        fout << "Measured max error: " << measured << "\n";
+        fout << "Exact hull size: " << exact.size() << "\n";
+        fout << "Exact hull computation time: " << exactElapsed.count() << " seconds\n";
+        approxCache.report(fout, false);
+        exactCache.report(fout);
+    } else {
+        approxCache.report(fout);
+    }
+    fout << "The points in the convex hull are:\n";
+    for (auto &p : hull) fout << "(" << p.x << ", " << p.y << ")\n";
+    fout.close();
+
+    cout << "\nApproximate hull: " << hull.size() << " points in " << elapsed.count() << " seconds\n";
+    cout << "Error bound " << bound;
+    if (compare) cout << ", measured " << measured;
+    cout << "\n";
+    cout << "Results saved to: " << outFile << endl;
+    return 0;
+}
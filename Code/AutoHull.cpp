@@ -0,0 +1,704 @@
+/*****************************************************************************
+*                  Adaptive (auto) Convex Hull selector code                 *
+*****************************************************************************/
+// The Results folders show that no single algorithm wins everywhere: gift
+// wrapping is fastest on small hulls and collapses on Shapes/Circle.txt,
+// IncRand and DivideAndConquer trade places across the Exponential sizes, and
+// Grid/Square put many points on the hull boundary. This program samples the
+// input, estimates hull size, presortedness and degeneracy, and then dispatches
+// to one of the engines below (copied from GiftWrap.cpp, DivideAndConquer.cpp
+// and IncRand.cpp, with the same exact orient2d() predicates). Degenerate input
+// goes to monotone chain; otherwise every engine's time is predicted from a
+// per-engine cost model and the cheapest one runs. Every choice is logged with
+// the reason for it.
+//
+// Costs and degeneracy thresholds are read from auto_thresholds.txt when
+// present. Running
+//   ./a.out calibrate file1.txt file2.txt ...
+// times every engine on every file on this machine, writes the table to
+// Auto_Calibration.txt and fits new costs and thresholds into auto_thresholds.txt.
+// A calibration file counts as degenerate when an engine runs far slower than
+// its cost model predicts on it (see calibrate()).
+// Run the executable with --cache to reuse hulls through HullCache.h; entries
+// are keyed by the engine chosen, as auto-<engine>.
+// To run code open Cmd in folder, type g++ -ffp-contract=off AutoHull.cpp, run executable.
+
+#include <algorithm>
+#include <unordered_set>
+#include <random>
+#include <vector>
+#include <string>
+#include <iostream>
+#include <fstream>
+#include <sstream>
+#include <chrono>
+#include <cmath>
+#include "RobustPredicates.h" // exact-sign orient2d()
+#include "HullCache.h"
+using namespace std;
+
+static const double EPS = 1e-9;
+int op_counter = 0;
+
+struct Point {
+    double x, y;
+
+    bool operator==(const Point &other) const {
+        return fabs(x - other.x) < EPS && fabs(y - other.y) < EPS;
+    }
+};
+
+struct PointHash {
+    size_t operator()(const Point &p) const {
+        // Scale doubles to integers to stabilize hashing
+        long long xi = llround(p.x * 1e9);
+        long long yi = llround(p.y * 1e9);
+        return std::hash<long long>()(xi) ^ (std::hash<long long>()(yi) << 1);
+    }
+};
+
+/*****************************************************************************
+*                 Engines (see the original files for details)               *
+*****************************************************************************/
+
+// ---- IncRand.cpp: monotone chain and randomized incremental ----
+
+// Sign is exact (adaptive precision), so it can be compared with 0 directly
+double cross(const Point &O, const Point &A, const Point &B) {
+    return orient2d(O, A, B);
+}
+
+bool lexLess(const Point &a, const Point &b) {
+    if (fabs(a.x - b.x) > EPS) return a.x < b.x;
+    return a.y < b.y - EPS;
+}
+
+// Andrew's monotone chain convex hull (returns CCW hull without duplicate last point)
+vector<Point> monotoneChain(vector<Point> pts) {
+    if (pts.size() <= 1) return pts;
+    sort(pts.begin(), pts.end(), lexLess);
+    // Remove near-duplicates post-sort
+    vector<Point> uniq;
+    uniq.reserve(pts.size());
+    for (auto &p : pts) {
+        if (uniq.empty() || !(p == uniq.back())) uniq.push_back(p);
+    }
+    pts.swap(uniq);
+    int n = (int)pts.size();
+    if (n <= 1) return pts;
+
+    vector<Point> lower, upper;
+    for (int i = 0; i < n; ++i) {
+        while (lower.size() >= 2 && (++op_counter, cross(lower[lower.size()-2], lower.back(), pts[i]) <= 0))
+            lower.pop_back();
+        lower.push_back(pts[i]);
+    }
+    for (int i = n - 1; i >= 0; --i) {
+        while (upper.size() >= 2 && (++op_counter, cross(upper[upper.size()-2], upper.back(), pts[i]) <= 0))
+            upper.pop_back();
+        upper.push_back(pts[i]);
+    }
+    // Concatenate, removing duplicate endpoints
+    lower.pop_back();
+    upper.pop_back();
+    lower.insert(lower.end(), upper.begin(), upper.end());
+    return lower;
+}
+
+// Point-in-convex-polygon test for CCW hull; returns true if inside or on boundary
+bool insideConvexHullCCW(const vector<Point> &hull, const Point &p) {
+    int n = (int)hull.size();
+    if (n < 3) return false;
+    for (int i = 0; i < n; ++i) {
+        int j = (i + 1) % n;
+        if (cross(hull[i], hull[j], p) < 0) return false;
+    }
+    return true;
+}
+
+// Adds a point that is outside the CCW hull in O(h): the chain of edges p can see is
+// replaced by two edges through p
+vector<Point> insertOutsidePoint(const vector<Point> &hull, const Point &p) {
+    int n = (int)hull.size();
+    vector<char> visible(n);
+    for (int i = 0; i < n; ++i) visible[i] = cross(hull[i], hull[(i + 1) % n], p) <= 0;
+
+    int start = -1;
+    for (int i = 0; i < n; ++i) {
+        if (visible[i] && !visible[(i - 1 + n) % n]) { start = i; break; }
+    }
+    if (start == -1) return hull;
+    int end = start;
+    while (visible[end]) end = (end + 1) % n;
+
+    vector<Point> updated{p};
+    for (int i = end; ; i = (i + 1) % n) {
+        updated.push_back(hull[i]);
+        if (i == start) break;
+    }
+    return updated;
+}
+
+// Randomized incremental hull; outside points are spliced in
+vector<Point> incrementalHull(vector<Point> pts) {
+    unordered_set<Point, PointHash> seen;
+    vector<Point> uniquePts;
+    uniquePts.reserve(pts.size());
+    for (auto &p : pts) {
+        if (seen.find(p) == seen.end()) {
+            seen.insert(p);
+            uniquePts.push_back(p);
+        }
+        op_counter++;
+    }
+
+    shuffle(uniquePts.begin(), uniquePts.end(), default_random_engine(random_device{}()));
+    if (uniquePts.size() <= 2) return uniquePts;
+
+    vector<Point> init{uniquePts[0], uniquePts[1], uniquePts[2]};
+    if (cross(init[0], init[1], init[2]) < 0) swap(init[1], init[2]);
+    vector<Point> hull = monotoneChain(init);
+    for (size_t k = 3; k < uniquePts.size(); ++k) {
+        Point p = uniquePts[k];
+        bool onHull = false;
+        for (const auto &q : hull) {
+            if (p == q) { onHull = true; break; }
+            op_counter++;
+        }
+        if (onHull) continue;
+        if (insideConvexHullCCW(hull, p)) continue;
+
+        if (hull.size() >= 3) {
+            hull = insertOutsidePoint(hull, p);
+        } else {
+            vector<Point> expanded = hull;
+            expanded.push_back(p);
+            hull = monotoneChain(expanded);
+        }
+    }
+    return hull;
+}
+
+// ---- DivideAndConquer.cpp ----
+
+// Orientation test: 0=collinear, 1=clockwise, -1=counterclockwise
+int orientation(const Point &a, const Point &b, const Point &c) {
+    double val = orient2d(a, b, c);
+    op_counter++;
+    if (val == 0) return 0;
+    return (val > 0 ? 1 : -1);
+}
+
+// Brute-force hull for <=5 points
+vector<Point> bruteHull(vector<Point> &pts) {
+    int n = pts.size();
+    if (n <= 1) return pts;
+    vector<Point> hull;
+
+    for (int i = 0; i < n; i++) {
+        for (int j = i+1; j < n; j++) {
+            int pos = 0, neg = 0;
+            for (int k = 0; k < n; k++) {
+                int o = orientation(pts[i], pts[j], pts[k]);
+                if (o > 0) pos++;
+                else if (o < 0) neg++;
+            }
+            if (pos == 0 || neg == 0) {
+                hull.push_back(pts[i]);
+                hull.push_back(pts[j]);
+            }
+        }
+    }
+
+    sort(hull.begin(), hull.end(), [](Point a, Point b){ return a.x < b.x || (a.x==b.x && a.y < b.y); });
+    hull.erase(unique(hull.begin(), hull.end(), [](Point a, Point b){ return a.x==b.x && a.y==b.y; }), hull.end());
+
+    Point center = {0,0};
+    for(auto &p:hull) { center.x += p.x; center.y += p.y; }
+    center.x /= hull.size(); center.y /= hull.size();
+    sort(hull.begin(), hull.end(), [&](Point a, Point b){
+        return atan2(a.y-center.y, a.x-center.x) < atan2(b.y-center.y, b.x-center.x);
+    });
+
+    return hull;
+}
+
+// Merge two convex hulls using upper and lower tangents
+vector<Point> mergeHulls(const vector<Point> &left, const vector<Point> &right) {
+    int nL = left.size(), nR = right.size();
+
+    int iL = max_element(left.begin(), left.end(), [](Point a, Point b){ return a.x < b.x; }) - left.begin();
+    int iR = min_element(right.begin(), right.end(), [](Point a, Point b){ return a.x < b.x; }) - right.begin();
+
+    int uL=iL, uR=iR;
+    bool done=false;
+    while(!done){
+        done=true;
+        while(orientation(right[uR], left[uL], left[(uL+1)%nL])==1) uL=(uL+1)%nL;
+        while(orientation(left[uL], right[uR], right[(uR-1+nR)%nR])==-1) { uR=(uR-1+nR)%nR; done=false; }
+    }
+
+    int lL=iL, lR=iR;
+    done=false;
+    while(!done){
+        done=true;
+        while(orientation(left[lL], right[lR], right[(lR+1)%nR])==1) lR=(lR+1)%nR;
+        while(orientation(right[lR], left[lL], left[(lL-1+nL)%nL])==-1) { lL=(lL-1+nL)%nL; done=false; }
+    }
+
+    vector<Point> merged;
+    int idx=uL;
+    merged.push_back(left[idx]);
+    while(idx!=lL){ idx=(idx+1)%nL; merged.push_back(left[idx]); }
+    idx=lR;
+    merged.push_back(right[idx]);
+    while(idx!=uR){ idx=(idx+1)%nR; merged.push_back(right[idx]); }
+
+    return merged;
+}
+
+// Divide-and-conquer convex hull
+vector<Point> divideHull(vector<Point> &pts) {
+    if(pts.size() <= 5) return bruteHull(pts);
+    sort(pts.begin(), pts.end(), [](Point a, Point b){ return a.x < b.x; });
+    vector<Point> left(pts.begin(), pts.begin() + pts.size()/2);
+    vector<Point> right(pts.begin() + pts.size()/2, pts.end());
+    vector<Point> leftHull = divideHull(left);
+    vector<Point> rightHull = divideHull(right);
+    return mergeHulls(leftHull, rightHull);
+}
+
+// ---- GiftWrap.cpp ----
+
+// returns 0 collinear, 1 clockwise, 2 counterclockwise
+int giftOrientation(const Point &p, const Point &q, const Point &r) {
+    double val = orient2d(p, q, r);
+    op_counter++;
+    if (val == 0) return 0;
+    return (val < 0) ? 1 : 2;
+}
+
+// Jarvis March; walks the 'next' chain into a vector. Stops after n steps so a
+// degenerate input that slipped past the selector cannot loop forever.
+vector<Point> giftWrapHull(const vector<Point> &points) {
+    int n = (int)points.size();
+    if (n < 3) return points;
+
+    int l = 0;
+    for (int i = 1; i < n; ++i) {
+        op_counter++;
+        if (points[i].x < points[l].x) l = i;
+    }
+
+    vector<Point> hull;
+    int p = l;
+    do {
+        hull.push_back(points[p]);
+        int q = (p + 1) % n;
+        for (int i = 0; i < n; ++i) {
+            if (giftOrientation(points[p], points[i], points[q]) == 2) q = i;
+        }
+        p = q;
+    } while (p != l && (int)hull.size() <= n);
+    return hull;
+}
+
+/*****************************************************************************
+*                                  Selector                                  *
+*****************************************************************************/
+
+static const char *ENGINES[] = {"gift", "divide", "incrand", "monotone"};
+static const int NUM_ENGINES = 4;
+static const size_t SAMPLE_SIZE = 2048;
+static const string THRESHOLD_FILE = "auto_thresholds.txt";
+
+// Each engine's running time is modelled as cost * work, where work is n*h for
+// gift wrapping and n*log2(n) for the others. Calibration fits the costs.
+struct Thresholds {
+    double cost[NUM_ENGINES] = {2.0e-8, 3.0e-8, 6.0e-8, 1.4e-8}; // seconds per unit of work; < 0 never chosen
+    double collinearMin = 1.0;     // degenerate when non-vertex boundary points per hull vertex exceed this
+    double lineMin = 0.2;          // degenerate when this fraction of the sample lies on one axis-parallel line
+};
+
+struct Features {
+    size_t n = 0;
+    double hullEst = 0;     // estimated hull size of the full input
+    string hullModel;       // which growth law hullEst was extrapolated with
+    double sortedFrac = 0;  // fraction of adjacent pairs in input order with non-decreasing x
+    double collinear = 0;   // sample points inside hull edges per hull vertex
+    double lineFrac = 0;    // largest fraction of sampled points sharing one x or one y value
+};
+
+Thresholds loadThresholds() {
+    Thresholds t;
+    ifstream fin(THRESHOLD_FILE);
+    string key;
+    double val;
+    while (fin >> key >> val) {
+        for (int e = 0; e < NUM_ENGINES; ++e) if (key == string("cost_") + ENGINES[e]) t.cost[e] = val;
+        if (key == "collinearMin") t.collinearMin = val;
+        else if (key == "lineMin") t.lineMin = val;
+    }
+    return t;
+}
+
+void saveThresholds(const Thresholds &t) {
+    ofstream fout(THRESHOLD_FILE);
+    for (int e = 0; e < NUM_ENGINES; ++e) fout << "cost_" << ENGINES[e] << " " << t.cost[e] << "\n";
+    fout << "collinearMin " << t.collinearMin << "\n"
+         << "lineMin " << t.lineMin << "\n";
+}
+
+// Largest fraction of values in v that are equal (points on one grid line)
+double largestLineFraction(vector<double> v) {
+    sort(v.begin(), v.end());
+    size_t best = 0, run = 0;
+    for (size_t i = 0; i < v.size(); ++i) {
+        run = (i > 0 && v[i] == v[i-1]) ? run + 1 : 1;
+        best = max(best, run);
+    }
+    return v.empty() ? 0 : (double)best / v.size();
+}
+
+// Least squares line y = a + b*x
+void fitLine(const vector<double> &x, const vector<double> &y, double &a, double &b) {
+    double n = x.size(), sx = 0, sy = 0, sxx = 0, sxy = 0;
+    for (size_t i = 0; i < x.size(); ++i) { sx += x[i]; sy += y[i]; sxx += x[i]*x[i]; sxy += x[i]*y[i]; }
+    double d = n * sxx - sx * sx;
+    b = d != 0 ? (n * sxy - sx * sy) / d : 0;
+    a = (sy - b * sx) / n;
+}
+
+Features sampleFeatures(const vector<Point> &pts) {
+    Features f;
+    f.n = pts.size();
+    if (pts.empty()) return f;
+    mt19937 rng(2400); // fixed seed so the same file always gets the same choice
+
+    // Random sample for hull size and degeneracy
+    vector<Point> sample;
+    if (pts.size() <= SAMPLE_SIZE) sample = pts;
+    else {
+        uniform_int_distribution<size_t> pick(0, pts.size() - 1);
+        for (size_t i = 0; i < SAMPLE_SIZE; ++i) sample.push_back(pts[pick(rng)]);
+    }
+    size_t s = sample.size();
+    vector<Point> hull = monotoneChain(sample);
+
+    // Hull size: average hull sizes of the sample split into 1, 2, 4 and 8 disjoint
+    // parts, then fit h ~ a + b*log2(m) (points spread over a polygon) and
+    // h ~ c*m^e (e ~ 1/3 for a disk, 1 in convex position). The power law blows
+    // up sampling noise when extrapolated, so it is only used when it fits the
+    // sizes clearly better than the logarithm.
+    vector<double> logm, hm, loghm;
+    for (size_t k = 1; k <= 8 && s / k >= 16; k *= 2) {
+        size_t m = s / k;
+        double total = 0;
+        for (size_t c = 0; c < k; ++c)
+            total += monotoneChain(vector<Point>(sample.begin() + c * m, sample.begin() + (c + 1) * m)).size();
+        logm.push_back(log2((double)m));
+        hm.push_back(total / k);
+        loghm.push_back(log2(total / k));
+    }
+    if (s == pts.size() || logm.size() < 2) {
+        f.hullEst = hull.size();
+        f.hullModel = "exact";
+    } else {
+        double la, lb, pa, pb;
+        fitLine(logm, hm, la, lb);
+        fitLine(logm, loghm, pa, pb);
+        pb = max(0.0, min(1.0, pb));
+        double logErr = 0, powErr = 0;
+        for (size_t i = 0; i < logm.size(); ++i) {
+            logErr += pow((la + lb * logm[i] - hm[i]) / hm[i], 2);
+            powErr += pow((exp2(pa + pb * logm[i]) - hm[i]) / hm[i], 2);
+        }
+        double logn = log2((double)pts.size());
+        bool logFit = powErr * 4 >= logErr;
+        f.hullEst = logFit ? la + lb * logn : exp2(pa + pb * logn);
+        f.hullEst = max((double)hull.size(), min((double)pts.size(), f.hullEst));
+        f.hullModel = logFit ? "a + b*log2(n)" : "c*n^" + to_string(pb).substr(0, 4);
+    }
+
+    // Collinear excess: sample points exactly on a hull edge that are not vertices
+    // (exact orient2d, so the test does not depend on the coordinate scale)
+    if (hull.size() >= 3) {
+        size_t onBoundary = 0;
+        for (const auto &p : sample) {
+            for (size_t i = 0; i < hull.size(); ++i) {
+                const Point &a = hull[i], &b = hull[(i + 1) % hull.size()];
+                if (orient2d(a, b, p) == 0 && !(p.x == a.x && p.y == a.y) && !(p.x == b.x && p.y == b.y) &&
+                    p.x >= min(a.x, b.x) && p.x <= max(a.x, b.x) &&
+                    p.y >= min(a.y, b.y) && p.y <= max(a.y, b.y)) {
+                    onBoundary++;
+                    break;
+                }
+            }
+        }
+        f.collinear = (double)onBoundary / hull.size();
+    } else {
+        f.collinear = (double)s; // everything is on one line
+    }
+
+    vector<double> xs, ys;
+    for (const auto &p : sample) { xs.push_back(p.x); ys.push_back(p.y); }
+    f.lineFrac = max(largestLineFraction(xs), largestLineFraction(ys));
+
+    // Presortedness on a contiguous window, since order is what matters here
+    size_t w = min(pts.size(), SAMPLE_SIZE);
+    size_t offset = pts.size() > w ? uniform_int_distribution<size_t>(0, pts.size() - w)(rng) : 0;
+    size_t sorted = 0;
+    for (size_t i = offset + 1; i < offset + w; ++i) if (pts[i].x >= pts[i-1].x) sorted++;
+    f.sortedFrac = w > 1 ? (double)sorted / (w - 1) : 1;
+    return f;
+}
+
+// Work units of the cost model. Random order has sortedFrac ~ 0.5; fully
+// x-sorted input cuts monotone chain's sort to about a sixth.
+double engineWork(int engine, size_t n, double h, double sortedFrac) {
+    double nlogn = n * max(1.0, log2((double)n));
+    if (string(ENGINES[engine]) == "gift") return n * max(1.0, h);
+    if (string(ENGINES[engine]) == "monotone") {
+        double presorted = max(0.0, min(1.0, (sortedFrac - 0.5) / 0.5));
+        return nlogn * (1 - 0.85 * presorted);
+    }
+    return nlogn;
+}
+
+// Picks an engine and explains why
+string chooseEngine(const Features &f, const Thresholds &t, string &reason) {
+    ostringstream why;
+    if (f.collinear >= t.collinearMin || f.lineFrac >= t.lineMin) {
+        why << "degenerate input (" << f.collinear << " boundary points per hull vertex, "
+            << f.lineFrac * 100 << "% of points on one grid line); monotone chain handles collinear and duplicate points";
+        reason = why.str();
+        return "monotone";
+    }
+    int best = NUM_ENGINES - 1;
+    double predicted[NUM_ENGINES];
+    for (int e = 0; e < NUM_ENGINES; ++e) {
+        predicted[e] = t.cost[e] * engineWork(e, f.n, f.hullEst, f.sortedFrac);
+        if (t.cost[e] >= 0 && predicted[e] < predicted[best]) best = e;
+    }
+    why << "estimated hull size " << f.hullEst << " (" << f.hullModel << "), x-sortedness "
+        << f.sortedFrac * 100 << "%; predicted seconds";
+    for (int e = 0; e < NUM_ENGINES; ++e) {
+        why << " " << ENGINES[e] << " ";
+        if (t.cost[e] < 0) why << "(disabled)";
+        else why << predicted[e];
+    }
+    reason = why.str();
+    return ENGINES[best];
+}
+
+vector<Point> runEngine(const string &engine, vector<Point> pts) {
+    if (engine == "gift") return giftWrapHull(pts);
+    if (engine == "divide") return divideHull(pts);
+    if (engine == "incrand") return incrementalHull(pts);
+    return monotoneChain(pts);
+}
+
+// Read points from CSV
+vector<Point> readPoints(const string &filename) {
+    ifstream fin(filename);
+    vector<Point> pts;
+    if(!fin){ cerr << "Cannot open file: " << filename << endl; return pts; }
+    double x, y; char comma;
+    while(fin >> x >> comma >> y) pts.push_back({x,y});
+    return pts;
+}
+
+/*****************************************************************************
+*                                 Calibration                                *
+*****************************************************************************/
+
+// One-feature threshold that best separates positive from negative samples.
+// positiveBelow: positives are expected at feature <= threshold.
+double fitThreshold(vector<pair<double, bool>> samples, bool positiveBelow, double fallback) {
+    bool anyPos = false, anyNeg = false;
+    for (auto &s : samples) (s.second ? anyPos : anyNeg) = true;
+    if (!anyPos || !anyNeg) return fallback; // nothing to separate on this machine's data
+
+    sort(samples.begin(), samples.end());
+    size_t best = 0, bestErr = samples.size() + 1;
+    for (size_t cut = 0; cut <= samples.size(); ++cut) {
+        // samples[0..cut) are below the threshold; no threshold falls between equal values
+        if (cut > 0 && cut < samples.size() && samples[cut-1].first == samples[cut].first) continue;
+        size_t err = 0;
+        for (size_t i = 0; i < samples.size(); ++i) {
+            bool predicted = (i < cut) == positiveBelow;
+            if (predicted != samples[i].second) err++;
+        }
+        if (err < bestErr) { bestErr = err; best = cut; }
+    }
+    if (best == 0) return positiveBelow ? samples[0].first - 1 : samples[0].first;
+    if (best == samples.size()) return positiveBelow ? samples.back().first : samples.back().first + 1;
+    return (samples[best-1].first + samples[best].first) / 2;
+}
+
+// A file is degenerate when some engine other than monotone chain runs this many
+// times slower per unit of work than its median over all calibration files
+static const double BLOWUP = 4.0;
+
+struct CalibrationRun {
+    string file;
+    Features f;
+    size_t h = 0;                        // true hull size (monotone chain)
+    double times[NUM_ENGINES];
+    bool wrong[NUM_ENGINES] = {false, false, false, false};
+};
+
+double median(vector<double> v) {
+    if (v.empty()) return 0;
+    sort(v.begin(), v.end());
+    return v.size() % 2 ? v[v.size() / 2] : (v[v.size() / 2 - 1] + v[v.size() / 2]) / 2;
+}
+
+int calibrate(const vector<string> &files) {
+    Thresholds t = loadThresholds();
+    vector<CalibrationRun> runs;
+    for (const auto &file : files) {
+        vector<Point> pts = readPoints(file);
+        if (pts.empty()) continue;
+        CalibrationRun r;
+        r.file = file;
+        r.f = sampleFeatures(pts);
+        vector<Point> hulls[NUM_ENGINES];
+        for (int e = 0; e < NUM_ENGINES; ++e) {
+            auto start = chrono::high_resolution_clock::now();
+            hulls[e] = runEngine(ENGINES[e], pts);
+            auto end = chrono::high_resolution_clock::now();
+            r.times[e] = chrono::duration<double>(end - start).count();
+        }
+        // An engine is wrong when its hull vertices differ from monotone chain's
+        // (collinear boundary points it keeps are dropped first)
+        const vector<Point> &reference = hulls[NUM_ENGINES - 1];
+        r.h = reference.size();
+        for (int e = 0; e < NUM_ENGINES - 1; ++e) {
+            vector<Point> vertices = monotoneChain(hulls[e]);
+            r.wrong[e] = vertices.size() != reference.size() ||
+                         !is_permutation(vertices.begin(), vertices.end(), reference.begin());
+        }
+        runs.push_back(r);
+    }
+    if (runs.empty()) { cerr << "No points read from any file.\n"; return 1; }
+
+    // Seconds per unit of work of every engine on every file it got right,
+    // with the true hull size, and each engine's median over the files
+    auto rate = [](const CalibrationRun &r, int e) { return r.times[e] / engineWork(e, r.f.n, r.h, r.f.sortedFrac); };
+    double typical[NUM_ENGINES];
+    for (int e = 0; e < NUM_ENGINES; ++e) {
+        vector<double> rates;
+        for (const auto &r : runs) if (!r.wrong[e]) rates.push_back(rate(r, e));
+        typical[e] = median(rates);
+    }
+
+    vector<pair<double, bool>> colS, lineS;
+    double time[NUM_ENGINES] = {0}, work[NUM_ENGINES] = {0};
+    int wrongCount[NUM_ENGINES] = {0}, clean = 0;
+
+    ofstream table("Auto_Calibration.txt");
+    table << "file n h hullEst sortedFrac collinear lineFrac gift divide incrand monotone best\n";
+    table << "(* marks an engine whose hull vertices differ from monotone chain's, ! one that ran over "
+          << BLOWUP << "x its median seconds per unit of work)\n";
+    for (const auto &r : runs) {
+        int best = 0;
+        bool blownUp[NUM_ENGINES] = {false, false, false, false};
+        bool degenerate = false;
+        for (int e = 0; e < NUM_ENGINES; ++e) {
+            if (r.times[e] < r.times[best]) best = e;
+            blownUp[e] = !r.wrong[e] && typical[e] > 0 && rate(r, e) > BLOWUP * typical[e];
+            if (e != NUM_ENGINES - 1 && blownUp[e]) degenerate = true;
+        }
+
+        table << r.file << " " << r.f.n << " " << r.h << " " << r.f.hullEst << " " << r.f.sortedFrac << " "
+              << r.f.collinear << " " << r.f.lineFrac;
+        for (int e = 0; e < NUM_ENGINES; ++e) table << " " << r.times[e] << (r.wrong[e] ? "*" : "") << (blownUp[e] ? "!" : "");
+        table << " " << ENGINES[best] << (degenerate ? " (degenerate)" : "") << "\n";
+        cout << r.file << ": fastest engine " << ENGINES[best] << (degenerate ? ", degenerate" : "") << "\n";
+
+        colS.push_back({r.f.collinear, degenerate});
+        lineS.push_back({r.f.lineFrac, degenerate});
+        if (degenerate) continue;
+        // Cost model: total time over total work, so the large files that
+        // matter most dominate the fit
+        clean++;
+        for (int e = 0; e < NUM_ENGINES; ++e) {
+            if (r.wrong[e]) { wrongCount[e]++; continue; }
+            time[e] += r.times[e];
+            work[e] += engineWork(e, r.f.n, r.h, r.f.sortedFrac);
+        }
+    }
+
+    for (int e = 0; e < NUM_ENGINES; ++e) {
+        if (clean > 0 && wrongCount[e] * 2 > clean) {
+            t.cost[e] = -1; // wrong on most ordinary inputs here; never choose it
+            cout << ENGINES[e] << " gave wrong hulls on " << wrongCount[e] << " of " << clean
+                 << " non-degenerate files; disabled\n";
+        } else if (work[e] > 0) {
+            t.cost[e] = time[e] / work[e];
+        }
+    }
+    t.collinearMin = fitThreshold(colS, false, t.collinearMin);
+    t.lineMin = fitThreshold(lineS, false, t.lineMin);
+    saveThresholds(t);
+
+    cout << "\nTimings saved to: Auto_Calibration.txt\n";
+    cout << "Thresholds saved to: " << THRESHOLD_FILE << "\n";
+    return 0;
+}
+
+int main(int argc, char* argv[]) {
+    if (argc >= 2 && string(argv[1]) == "calibrate") {
+        if (argc < 3) {
+            cout << "Usage: ./a.out calibrate <points_file> [more files...]\n";
+            return 1;
+        }
+        return calibrate(vector<string>(argv + 2, argv + argc));
+    }
+
+    string filename;
+    cout << "Enter input .txt file: ";
+    cin >> filename;
+    vector<Point> points = readPoints(filename);
+    if(points.empty()) return 1;
+
+    Thresholds t = loadThresholds();
+
+    auto start = chrono::high_resolution_clock::now();
+    Features f = sampleFeatures(points);
+    string reason;
+    string engine = chooseEngine(f, t, reason);
+    auto mid = chrono::high_resolution_clock::now();
+    op_counter = 0; // count the engine's operations only, not the sampling
+    orient_calls = orient_slow = 0;
+    HullCache cache("auto-" + engine, "orient2d", cacheLimitMB(argc, argv));
+    vector<Point> hull;
+    bool cached = cache.lookup(points, hull);
+    auto computeStart = chrono::high_resolution_clock::now();
+    if (!cached) hull = runEngine(engine, points);
+    auto end = chrono::high_resolution_clock::now();
+
+    chrono::duration<double> elapsed = end - start;
+    chrono::duration<double> sampling = mid - start;
+    if (cached) op_counter = (int)cache.operations();
+    else cache.store(hull, chrono::duration<double>(end - computeStart).count(), op_counter, orient_calls, orient_slow);
+
+    string outFile = "Auto_Results_" + filename;
+    ofstream fout(outFile);
+    for (ostream *os : {(ostream *)&cout, (ostream *)&fout}) {
+        *os << hull.size() << " point hull size.\n";
+        *os << "The Algorithm made " << op_counter << " operations.\n";
+        *os << "The size of the array was " << points.size() << ".\n";
+        *os << "Hull computation time: " << elapsed.count() << " seconds (sampling "
+            << sampling.count() << " seconds)\n";
+        *os << "Engine: " << engine << "\n";
+        *os << "Reason: " << reason << "\n";
+    }
+    cache.report(fout);
+    fout << "The points in the convex hull are:\n";
+    for(auto &p:hull) fout << "(" << p.x << ", " << p.y << ")\n";
+    fout.close();
+    cout << "Results saved to: " << outFile << endl;
+    return 0;
+}
@@ -0,0 +1,144 @@
+/*****************************************************************************
+*              Batched multi-subset Convex Hull code (shared pool)           *
+*****************************************************************************/
+// Computes the hulls of many subsets of one point array in a single run,
+// instead of writing every subset to its own file and running an executable
+// per file. This is the driver for the batchHulls() API in BatchHull.h: the
+// pool is sorted once up front, and subsets are spread over worker threads.
+//
+// The subsets file has one subset per line, as indices into the points file
+// separated by spaces or commas. Enter a number instead of a file name to
+// generate that many random rectangular regions of the pool as subsets.
+// To run code open Cmd in folder, type g++ -pthread BatchHull.cpp, run executable.
+
+#include <algorithm>
+#include <vector>
+#include <string>
+#include <iostream>
+#include <fstream>
+#include <sstream>
+#include <chrono>
+#include <random>
+#include <thread>
+#include <cmath>
+#include <cerrno>
+#include <climits>
+#include <cstdlib>
+#include "BatchHull.h"
+using namespace std;
+
+struct Point {
+    double x, y;
+};
+
+// Read points from CSV
+vector<Point> readPoints(const string &filename) {
+    ifstream fin(filename);
+    vector<Point> pts;
+    if(!fin){ cerr << "Cannot open file: " << filename << endl; return pts; }
+    double x, y; char comma;
+    while(fin >> x >> comma >> y) pts.push_back({x,y});
+    return pts;
+}
+
+// One subset per line; indices separated by spaces or commas
+vector<vector<int>> readSubsets(const string &filename, size_t poolSize) {
+    ifstream fin(filename);
+    vector<vector<int>> subsets;
+    if(!fin){ cerr << "Cannot open file: " << filename << endl; return subsets; }
+    string line;
+    while (getline(fin, line)) {
+        replace(line.begin(), line.end(), ',', ' ');
+        istringstream ss(line);
+        vector<int> subset;
+        long long i;
+        while (ss >> i) {
+            if (i < 0 || (size_t)i >= poolSize) { cerr << "Warning: skipped out of range index " << i << "\n"; continue; }
+            subset.push_back((int)i);
+        }
+        if (!subset.empty()) subsets.push_back(subset);
+    }
+    return subsets;
+}
+
+// Random axis-aligned regions of the pool's bounding box, each between 1% and 25% of it per side
+vector<vector<int>> randomRegions(const vector<Point> &pts, int count) {
+    double xmin = INFINITY, xmax = -INFINITY, ymin = INFINITY, ymax = -INFINITY;
+    for (const auto &p : pts) {
+        xmin = min(xmin, p.x); xmax = max(xmax, p.x);
+        ymin = min(ymin, p.y); ymax = max(ymax, p.y);
+    }
+    mt19937 rng(2400);
+    uniform_real_distribution<double> unit(0, 1), side(0.01, 0.25);
+    vector<vector<int>> subsets;
+    for (int s = 0; s < count; ++s) {
+        double w = side(rng) * (xmax - xmin), h = side(rng) * (ymax - ymin);
+        double x0 = xmin + unit(rng) * (xmax - xmin - w), y0 = ymin + unit(rng) * (ymax - ymin - h);
+        vector<int> subset;
+        for (size_t i = 0; i < pts.size(); ++i)
+            if (pts[i].x >= x0 && pts[i].x <= x0 + w && pts[i].y >= y0 && pts[i].y <= y0 + h) subset.push_back((int)i);
+        subsets.push_back(subset);
+    }
+    return subsets;
+}
+
+int main() {
+    string filename, subsetSource;
+    int threads;
+    cout << "Enter input .txt file: ";
+    cin >> filename;
+    cout << "Subsets file (or how many random regions to generate): ";
+    cin >> subsetSource;
+    cout << "Worker threads (0 = auto): ";
+    cin >> threads;
+    if (!cin || threads <= 0) threads = max(1u, thread::hardware_concurrency());
+
+    vector<Point> points = readPoints(filename);
+    if(points.empty()) return 1;
+
+    vector<vector<int>> subsets;
+    bool generated = !subsetSource.empty() && all_of(subsetSource.begin(), subsetSource.end(), ::isdigit);
+    if (generated) {
+        errno = 0;
+        unsigned long long count = strtoull(subsetSource.c_str(), nullptr, 10);
+        if (errno == ERANGE || count > INT_MAX) { cerr << "Too many regions: " << subsetSource << "\n"; return 1; }
+        subsets = randomRegions(points, (int)count);
+    }
+    else subsets = readSubsets(subsetSource, points.size());
+    if (subsets.empty()) { cerr << "No subsets to compute. Exiting.\n"; return 1; }
+    size_t totalIndices = 0;
+    for (const auto &s : subsets) totalIndices += s.size();
+
+    auto start = chrono::high_resolution_clock::now();
+    PresortedPool<Point> pool(points);
+    auto sorted = chrono::high_resolution_clock::now();
+    vector<vector<int>> hulls = batchHulls(pool, subsets, threads);
+    auto end = chrono::high_resolution_clock::now();
+
+    double presort = chrono::duration<double>(sorted - start).count();
+    double batch = chrono::duration<double>(end - sorted).count();
+    double total = chrono::duration<double>(end - start).count();
+
+    // Same batch on one thread, for the speedup figure
+    auto serialStart = chrono::high_resolution_clock::now();
+    batchHulls(pool, subsets, 1);
+    double serial = chrono::duration<double>(chrono::high_resolution_clock::now() - serialStart).count();
+
+    string outFile = "Batch_Results_" + filename;
+    ofstream fout(outFile);
+    for (ostream *os : {(ostream *)&cout, (ostream *)&fout}) {
+        *os << subsets.size() << " subsets (" << totalIndices << " indices) of a pool of " << points.size() << " points.\n";
+        *os << "Presort time: " << presort << " seconds\n";
+        *os << "Hull computation time: " << batch << " seconds on " << threads << " threads ("
+            << serial << " seconds on 1 thread)\n";
+        *os << "Throughput: " << subsets.size() / total << " subsets/second (including presort)\n";
+    }
+    for (size_t s = 0; s < hulls.size(); ++s) {
+        fout << "Subset " << s << ": " << subsets[s].size() << " points, " << hulls[s].size() << " point hull:";
+        for (int i : hulls[s]) fout << " (" << points[i].x << ", " << points[i].y << ")";
+        fout << "\n";
+    }
+    fout.close();
+    cout << "Results saved to: " << outFile << endl;
+    return 0;
+}
@@ -0,0 +1,98 @@
+/*****************************************************************************
+*            Batched multi-subset Convex Hull API (shared pool, header)      *
+*****************************************************************************/
+// Hulls of many subsets of one point array in a single call. Subsets are lists
+// of indices into the shared pool, so no points are copied. Build a
+// PresortedPool once (every point gets its rank in x-then-y order) and each
+// subset only has to sort plain integer ranks before the monotone chain pass:
+//   PresortedPool<Point> pool(points);
+//   vector<vector<int>> hulls = batchHulls(pool, subsets, threads);
+// Works on any point struct with double x, y members. BatchHull.cpp is a
+// driver for it. Compile with -pthread.
+
+#ifndef BATCH_HULL_H
+#define BATCH_HULL_H
+
+#include <algorithm>
+#include <vector>
+#include <thread>
+#include <atomic>
+
+namespace batch {
+
+template <class P>
+double cross(const P &O, const P &A, const P &B) {
+    return (A.x - O.x) * (B.y - O.y) - (A.y - O.y) * (B.x - O.x);
+}
+
+} // namespace batch
+
+// One presort shared by every subset: order[r] is the index of the point with
+// rank r in x-then-y order, rank[i] is the rank of point i.
+template <class P>
+struct PresortedPool {
+    const std::vector<P> &pts;
+    std::vector<int> order, rank;
+
+    explicit PresortedPool(const std::vector<P> &points) : pts(points), order(points.size()), rank(points.size()) {
+        for (size_t i = 0; i < pts.size(); ++i) order[i] = (int)i;
+        std::sort(order.begin(), order.end(), [&](int a, int b) {
+            return pts[a].x < pts[b].x || (pts[a].x == pts[b].x && pts[a].y < pts[b].y);
+        });
+        for (size_t r = 0; r < order.size(); ++r) rank[order[r]] = (int)r;
+    }
+};
+
+// Monotone chain over a subset of the pool; returns the CCW hull as pool indices.
+// 'scratch' is reused between calls by the same thread.
+template <class P>
+std::vector<int> subsetHull(const PresortedPool<P> &pool, const std::vector<int> &subset, std::vector<int> &scratch) {
+    using batch::cross;
+    const std::vector<P> &pts = pool.pts;
+    scratch.clear();
+    for (int i : subset) scratch.push_back(pool.rank[i]);
+    std::sort(scratch.begin(), scratch.end());
+
+    // back to indices in sorted order, dropping repeated indices and duplicate points
+    std::vector<int> sorted;
+    sorted.reserve(scratch.size());
+    for (int r : scratch) {
+        int i = pool.order[r];
+        if (!sorted.empty() && pts[sorted.back()].x == pts[i].x && pts[sorted.back()].y == pts[i].y) continue;
+        sorted.push_back(i);
+    }
+    int n = (int)sorted.size();
+    if (n <= 2) return sorted;
+
+    std::vector<int> hull(2 * n);
+    int k = 0;
+    for (int i = 0; i < n; ++i) {
+        while (k >= 2 && cross(pts[hull[k-2]], pts[hull[k-1]], pts[sorted[i]]) <= 0) k--;
+        hull[k++] = sorted[i];
+    }
+    for (int i = n - 2, t = k + 1; i >= 0; --i) {
+        while (k >= t && cross(pts[hull[k-2]], pts[hull[k-1]], pts[sorted[i]]) <= 0) k--;
+        hull[k++] = sorted[i];
+    }
+    hull.resize(k - 1);
+    return hull;
+}
+
+// Hulls of every subset of the pool, computed on 'threads' worker threads
+template <class P>
+std::vector<std::vector<int>> batchHulls(const PresortedPool<P> &pool, const std::vector<std::vector<int>> &subsets, int threads) {
+    std::vector<std::vector<int>> hulls(subsets.size());
+    std::atomic<size_t> nextSubset(0);
+    auto worker = [&]() {
+        std::vector<int> scratch;
+        for (size_t s = nextSubset++; s < subsets.size(); s = nextSubset++)
+            hulls[s] = subsetHull(pool, subsets[s], scratch);
+    };
+    std::vector<std::thread> workers;
+    for (int t = 1; t < threads; ++t) workers.emplace_back(worker);
+    worker(); // this thread works too
+    for (auto &w : workers) w.join();
+    return hulls;
+}
+
+#endif
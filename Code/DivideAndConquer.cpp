@@ -6,7 +6,9 @@
 // a file with outputs and operation count.
 // This code is being used for research purposes only. Any orignal comments
 // made on unchanged code are untouched. Added comments are to the side or in boxes
-// To run code open Cmd in folder, type g++ DivideAndConquer.cpp, run executable.
+// To run code open Cmd in folder, type g++ -ffp-contract=off DivideAndConquer.cpp, run executable.
+// Run the executable with --analytics to add rotating calipers measurements to the results,
+// and/or with --cache to reuse hulls through HullCache.h.
 // 
 // Orininal code notes are below:
 // C++ program to to find convex
@@ -18,6 +20,9 @@
 #include <algorithm>
 #include <chrono>
 #include <cmath>
+#include "RotatingCalipers.h"
+#include "RobustPredicates.h"
+#include "HullCache.h"
 using namespace std;
 
 struct Point {
@@ -28,10 +33,11 @@ struct Point {
 int op_counter = 0;
 
 // Orientation test: 0=collinear, 1=clockwise, -1=counterclockwise
+// Sign comes from the exact orient2d() in RobustPredicates.h, so no EPS threshold
 int orientation(const Point &a, const Point &b, const Point &c) {
-    double val = (b.x - a.x)*(c.y - a.y) - (b.y - a.y)*(c.x - a.x);
+    double val = orient2d(a, b, c);
     op_counter++;
-    if (fabs(val) < 1e-9) return 0;
+    if (val == 0) return 0;
     return (val > 0 ? 1 : -1);
 }
 
@@ -130,22 +136,36 @@ vector<Point> readPoints(const string &filename) {
     return pts;
 }
 
-int main() {
+int main(int argc, char* argv[]) {
+    bool analytics = find(argv + 1, argv + argc, string("--analytics")) != argv + argc;
     string filename;
     cout << "Enter input .txt file: ";
     cin >> filename;
     vector<Point> points = readPoints(filename);
     if(points.empty()) return 1;
 
+    HullCache cache("divide", "orient2d", cacheLimitMB(argc, argv));
+    vector<Point> hull;
     auto start = chrono::high_resolution_clock::now();
-    vector<Point> hull = divideHull(points);
+    bool cached = cache.lookup(points, hull);
+    auto computeStart = chrono::high_resolution_clock::now();
+    if (!cached) hull = divideHull(points);
     auto end = chrono::high_resolution_clock::now();
 
     chrono::duration<double> elapsed = end-start;
+    if (cached) {
+        op_counter = (int)cache.operations();
+        orient_calls = cache.orientCalls();
+        orient_slow = cache.orientSlow();
+    }
+    else cache.store(hull, chrono::duration<double>(end - computeStart).count(), op_counter, orient_calls, orient_slow);
     string outFile = "Divide_Results_" + filename;
     ofstream fout(outFile);
     fout << "Hull computation time: " << elapsed.count() << " seconds\n";
     fout << "Operations: " << op_counter << "\n";
+    fout << "Orientation tests: " << orient_calls << " (" << orient_slow << " needed exact arithmetic)\n";
+    cache.report(fout);
+    if(analytics) writeAnalytics(fout, hullAnalytics(hull)); // optional rotating calipers fields
     fout << "Hull points:\n";
     for(auto &p:hull) fout << p.x << "," << p.y << "\n";
     fout.close();
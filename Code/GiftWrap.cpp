@@ -8,7 +8,9 @@
 // being able to read the coordinates from a file and change those cordinates into an array
 // of the size needed to complete the code. Original comments made on unchanged
 // code are untouched. Added comments are to the side or in boxes.
-// To run code open Cmd in folder, type g++ GiftWrap.cpp, run executable.
+// To run code open Cmd in folder, type g++ -ffp-contract=off GiftWrap.cpp, run executable.
+// Run the executable with --analytics to add rotating calipers measurements to the results,
+// and/or with --cache to reuse hulls through HullCache.h.
 // giftwrap_fixed.cpp
 // 
 // Original codes notes are below 
@@ -25,6 +27,10 @@
 #include <algorithm>
 #include <iomanip>
 #include <cmath>
+#include <numeric>
+#include "RotatingCalipers.h"
+#include "RobustPredicates.h"
+#include "HullCache.h"
 
 using namespace std;
 
@@ -34,19 +40,34 @@ struct Point {
     double x, y;
 };
 
-// orientation using double, returns 0 collinear, 1 clockwise, 2 counterclockwise
+// orientation using the exact-sign orient2d() from RobustPredicates.h (no EPS needed),
+// returns 0 collinear, 1 clockwise, 2 counterclockwise
 int orientation(const Point &p, const Point &q, const Point &r) {
-    double val = (q.y - p.y) * (r.x - q.x) - (q.x - p.x) * (r.y - q.y);
+    double val = orient2d(p, q, r);
     op_counter++;
-    const double EPS = 1e-12;
-    if (fabs(val) < EPS) return 0;
-    return (val > 0) ? 1 : 2;
+    if (val == 0) return 0;
+    return (val < 0) ? 1 : 2;
+}
+
+// Puts a hull cached in march order back into next[]; returns the index of its first point
+int chainToNext(const vector<Point> &points, const vector<Point> &chain, vector<int> &next) {
+    auto less = [](const Point &a, const Point &b) { return a.x < b.x || (a.x == b.x && a.y < b.y); };
+    vector<int> order(points.size());
+    iota(order.begin(), order.end(), 0);
+    stable_sort(order.begin(), order.end(), [&](int a, int b) { return less(points[a], points[b]); });
+    vector<int> idx;
+    for (const Point &h : chain)
+        idx.push_back(*lower_bound(order.begin(), order.end(), h, [&](int a, const Point &b) { return less(points[a], b); }));
+    for (size_t k = 0; k < idx.size(); ++k) next[idx[k]] = idx[(k + 1) % idx.size()];
+    return idx.empty() ? 0 : idx[0];
 }
 
 // Jarvis March (Gift Wrapping)
 // points: vector of input points, n = points.size()
 // outputs the hull indices in 'next' (size n, -1 if not on hull)
-void convexHull(const vector<Point> &points, vector<int> &next, const string &in_filename) {
+// analytics: also write rotating calipers measurements of the hull
+// cache: hulls are looked up there first and stored there after a march
+void convexHull(const vector<Point> &points, vector<int> &next, const string &in_filename, bool analytics, HullCache &cache) {
     int n = (int)points.size();
     next.assign(n, -1);
 
@@ -54,31 +75,51 @@ void convexHull(const vector<Point> &points, vector<int> &next, const string &in
 
     // Start timing the hull algorithm
     auto start = chrono::high_resolution_clock::now();
+    vector<Point> chain;
+    bool cached = cache.lookup(points, chain);
+    auto computeStart = chrono::high_resolution_clock::now();
 
     // Find leftmost point index
     int l = 0;
-    for (int i = 1; i < n; ++i) {
-        op_counter++;
-        if (points[i].x < points[l].x) l = i;
-    }
+    if (cached) l = chainToNext(points, chain, next);
+    else {
+        for (int i = 1; i < n; ++i) {
+            op_counter++;
+            if (points[i].x < points[l].x) l = i;
+        }
 
-    int p = l;
-    do {
-        int q = (p + 1) % n;
-        for (int i = 0; i < n; ++i) {
-            // choose the most counterclockwise point
-            if (orientation(points[p], points[i], points[q]) == 2) {
-                q = i;
+        int p = l;
+        do {
+            int q = (p + 1) % n;
+            for (int i = 0; i < n; ++i) {
+                // choose the most counterclockwise point
+                if (orientation(points[p], points[i], points[q]) == 2) {
+                    q = i;
+                }
+                // note: orientation increments op_counter
             }
-            // note: orientation increments op_counter
-        }
-        next[p] = q;
-        p = q;
-    } while (p != l);
+            next[p] = q;
+            p = q;
+        } while (p != l);
+    }
 
     auto end = chrono::high_resolution_clock::now();
     chrono::duration<double> elapsed = end - start;
 
+    if (cached) {
+        op_counter = (int)cache.operations();
+        orient_calls = cache.orientCalls();
+        orient_slow = cache.orientSlow();
+    } else {
+        // walk the next[] chain from the leftmost point to get the hull in order
+        int i = l;
+        do {
+            chain.push_back(points[i]);
+            i = next[i];
+        } while (i != l && i != -1 && (int)chain.size() <= n);
+        cache.store(chain, chrono::duration<double>(end - computeStart).count(), op_counter, orient_calls, orient_slow);
+    }
+
     // prepare output file
     string outname = "Gift_Results_" + in_filename;
     ofstream outputFile(outname);
@@ -96,12 +137,20 @@ void convexHull(const vector<Point> &points, vector<int> &next, const string &in
     cout << "The Algorithm made " << op_counter << " operations.\n";
     cout << "The size of the array was " << n << ".\n";
     cout << "Hull computation time: " << fixed << setprecision(6) << elapsed.count() << " seconds\n";
+    cout << "Orientation tests: " << orient_calls << " (" << orient_slow << " needed exact arithmetic)\n";
     cout << "The points in the convex hull are:\n";
 
     outputFile << hullSize << " point hull size.\n";
     outputFile << "The Algorithm made " << op_counter << " operations.\n";
     outputFile << "The size of the array was " << n << ".\n";
     outputFile << "Hull computation time: " << fixed << setprecision(6) << elapsed.count() << " seconds\n";
+    outputFile << "Orientation tests: " << orient_calls << " (" << orient_slow << " needed exact arithmetic)\n";
+    cache.report(outputFile);
+    if (analytics) {
+        outputFile << defaultfloat;
+        writeAnalytics(outputFile, hullAnalytics(chain));
+        outputFile << fixed;
+    }
     outputFile << "The points in the convex hull are:\n";
 
     for (int i = 0; i < n; ++i) {
@@ -189,7 +238,9 @@ vector<Point> read_points_robust(const string &filename) {
     return pts;
 }
 
-int main() {
+int main(int argc, char* argv[]) {
+    bool analytics = find(argv + 1, argv + argc, string("--analytics")) != argv + argc;
+    HullCache cache("gift", "orient2d", cacheLimitMB(argc, argv));
     string infile;
     cout << "Please enter a file name, please include .txt in the file name.\n";
     getline(cin, infile);
@@ -203,7 +254,7 @@ int main() {
 
     // use vector<int> for next pointers
     vector<int> next;
-    convexHull(pts, next, infile);
+    convexHull(pts, next, infile, analytics, cache);
 
     return 0;
 }
\ No newline at end of file
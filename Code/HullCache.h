@@ -0,0 +1,280 @@
+/*****************************************************************************
+*                 Content-addressed Convex Hull cache (header)               *
+*****************************************************************************/
+// The *_Results_* files are named after the input file only, so they go stale
+// when the data changes and are overwritten on every run. HullCache sits in
+// front of an engine: results are keyed by a hash of the parsed points plus
+// the engine and the predicate mode it really uses, so an edited file is a new
+// key and an unchanged one, under any name, is a hit.
+// Entries are small binary files in hull_cache/. A hit refreshes the entry's
+// modification time, and the oldest entries are evicted once the directory
+// grows past the size limit (least recently used first). Hit rate and the
+// compute time saved by hits are kept in hull_cache/stats.txt, which is only
+// updated while holding hull_cache/stats.lock so concurrent runs keep every count.
+// Works on any point struct with double x, y members. In an engine's main():
+//   HullCache cache("gift", "orient2d", cacheLimitMB(argc, argv));
+//   if (!cache.lookup(points, hull)) { ...compute hull...; cache.store(hull, seconds, op_counter, orient_calls, orient_slow); }
+//   else { op_counter = cache.operations(); orient_calls = cache.orientCalls(); orient_slow = cache.orientSlow(); }
+//   cache.report(fout);
+// The cache is off (lookup always misses, nothing is written) unless the
+// program is run with --cache, or --cache=<MB> for a size limit other than 64 MB.
+// Needs C++17 (std::filesystem).
+
+#ifndef HULL_CACHE_H
+#define HULL_CACHE_H
+
+#include <algorithm>
+#include <vector>
+#include <string>
+#include <fstream>
+#include <ostream>
+#include <iostream>
+#include <chrono>
+#include <cstdint>
+#include <cstdlib>
+#include <cstring>
+#include <cstdio>
+#include <filesystem>
+#include <random>
+#include <thread>
+
+// Size limit in MB from a --cache or --cache=<MB> argument, 0 when caching is off
+inline double cacheLimitMB(int argc, char *argv[]) {
+    for (int i = 1; i < argc; ++i) {
+        if (std::strcmp(argv[i], "--cache") == 0) return 64;
+        if (std::strncmp(argv[i], "--cache=", 8) == 0) return std::max(0.0, std::atof(argv[i] + 8));
+    }
+    return 0;
+}
+
+class HullCache {
+public:
+    // engine and predicate name the key; limitMB <= 0 disables the cache
+    HullCache(const std::string &engine, const std::string &predicate, double limitMB)
+        : engine(engine), predicate(predicate), limitBytes(limitMB * 1024 * 1024) {}
+
+    bool enabled() const { return limitBytes > 0; }
+    // counters of the engine run behind this result
+    long long operations() const { return ops; }
+    long long orientCalls() const { return calls; }
+    long long orientSlow() const { return slow; }
+
+    // Fills hull and returns true on a hit. Must come before store().
+    template <class P>
+    bool lookup(const std::vector<P> &pts, std::vector<P> &hull) {
+        if (!enabled()) return false;
+        auto start = std::chrono::high_resolution_clock::now();
+        std::error_code ec;
+        std::filesystem::create_directories(DIR, ec);
+        inputSize = pts.size();
+        path = entryPath(hashPoints(pts));
+
+        Header h;
+        std::vector<double> xy;
+        std::ifstream fin(path, std::ios::binary);
+        wasHit = fin && fin.read((char *)&h, sizeof(h)) &&
+                 std::memcmp(h.magic, MAGIC, 4) == 0 && h.version == VERSION && h.inputSize == inputSize;
+        if (wasHit) {
+            xy.resize(2 * h.hullSize);
+            wasHit = (bool)fin.read((char *)xy.data(), xy.size() * sizeof(double));
+        }
+        fin.close();
+        if (!wasHit) return false;
+
+        hull.resize(h.hullSize);
+        for (size_t i = 0; i < hull.size(); ++i) { hull[i].x = xy[2*i]; hull[i].y = xy[2*i+1]; }
+        std::filesystem::last_write_time(path, std::filesystem::file_time_type::clock::now(), ec); // mark as recently used
+        seconds = h.computeSeconds;
+        ops = h.operations;
+        calls = h.orientCalls;
+        slow = h.orientSlow;
+
+        double lookupTime = std::chrono::duration<double>(std::chrono::high_resolution_clock::now() - start).count();
+        updateStats([&](Stats &s) {
+            s.hits++;
+            s.secondsSaved += std::max(0.0, seconds - lookupTime);
+        });
+        return true;
+    }
+
+    // Saves a freshly computed hull under the key of the last lookup(), with the
+    // engine's operation and orientation test counts
+    template <class P>
+    void store(const std::vector<P> &hull, double computeSeconds, long long operations,
+               long long orientCalls = 0, long long orientSlow = 0) {
+        seconds = computeSeconds;
+        ops = operations;
+        calls = orientCalls;
+        slow = orientSlow;
+        if (!enabled() || path.empty()) return;
+
+        Header h;
+        std::memcpy(h.magic, MAGIC, 4);
+        h.version = VERSION;
+        h.inputSize = inputSize;
+        h.hullSize = hull.size();
+        h.operations = operations;
+        h.orientCalls = orientCalls;
+        h.orientSlow = orientSlow;
+        h.computeSeconds = computeSeconds;
+        // write to a temporary name first so a crash never leaves a torn entry behind;
+        // the random part keeps runs storing the same key from sharing the file
+        char suffix[17];
+        std::snprintf(suffix, sizeof(suffix), "%016llx",
+                      (unsigned long long)std::random_device{}() << 32 ^ std::random_device{}());
+        std::string tmp = path + "." + suffix + ".tmp";
+        {
+            std::ofstream fout(tmp, std::ios::binary | std::ios::trunc);
+            if (!fout) { std::cerr << "Warning: could not write cache entry " << path << "\n"; return; }
+            fout.write((const char *)&h, sizeof(h));
+            for (const auto &p : hull) {
+                double xy[2] = {(double)p.x, (double)p.y};
+                fout.write((const char *)xy, sizeof(xy));
+            }
+        }
+        std::error_code ec;
+        std::filesystem::rename(tmp, path, ec);
+        if (ec) {
+            std::cerr << "Warning: could not write cache entry " << path << "\n";
+            std::filesystem::remove(tmp, ec);
+        }
+
+        updateStats([&](Stats &s) {
+            s.misses++;
+            s.evictions += evict();
+        });
+    }
+
+    // totals: also print the hit rate and time saved over every run so far
+    void report(std::ostream &os, bool totals = true) const {
+        if (!enabled()) return;
+        os << "Cache: " << (wasHit ? "hit" : "miss") << ", engine took " << seconds << " seconds (" << path << ")\n";
+        if (!totals) return;
+        Stats s = loadStats();
+        long long lookups = s.hits + s.misses;
+        os << "Cache hit rate: " << (lookups ? 100.0 * s.hits / lookups : 0) << "% ("
+           << s.hits << " hits, " << s.misses << " misses, " << s.evictions << " evictions)\n";
+        os << "Time saved by cache: " << s.secondsSaved << " seconds\n";
+    }
+
+private:
+    static constexpr const char *DIR = "hull_cache";
+    static constexpr char MAGIC[4] = {'H', 'U', 'L', 'L'};
+    static constexpr uint32_t VERSION = 2;
+
+    // Fixed header in front of the hull coordinates in every entry file
+    struct Header {
+        char magic[4];
+        uint32_t version;
+        uint64_t inputSize;     // number of input points, guards against hash collisions
+        uint64_t hullSize;
+        int64_t operations;
+        int64_t orientCalls, orientSlow;
+        double computeSeconds;  // what a hit on this entry saves
+    };
+
+    struct Stats {
+        long long hits = 0, misses = 0, evictions = 0;
+        double secondsSaved = 0;
+    };
+
+    std::string engine, predicate, path;
+    double limitBytes;
+    uint64_t inputSize = 0;
+    bool wasHit = false;
+    double seconds = 0;
+    long long ops = 0, calls = 0, slow = 0;
+
+    // 64-bit hash of the raw coordinate bits, one word at a time
+    template <class P>
+    static uint64_t hashPoints(const std::vector<P> &pts) {
+        uint64_t h = 0xcbf29ce484222325ULL ^ pts.size();
+        for (const auto &p : pts) {
+            double xy[2] = {(double)p.x, (double)p.y};
+            uint64_t w[2];
+            std::memcpy(w, xy, sizeof(w));
+            for (uint64_t v : w) {
+                h ^= v;
+                h *= 0x100000001b3ULL;
+                h ^= h >> 29;
+            }
+        }
+        // final avalanche (murmur3 fmix64)
+        h ^= h >> 33; h *= 0xff51afd7ed558ccdULL;
+        h ^= h >> 33; h *= 0xc4ceb9fe1a85ec53ULL;
+        h ^= h >> 33;
+        return h;
+    }
+
+    std::string entryPath(uint64_t hash) const {
+        char hex[17];
+        std::snprintf(hex, sizeof(hex), "%016llx", (unsigned long long)hash);
+        return std::string(DIR) + "/" + hex + "_" + engine + "_" + predicate + ".hull";
+    }
+
+    // Remove least recently used entries until the cache fits in the limit
+    int evict() const {
+        namespace fs = std::filesystem;
+        std::vector<std::pair<fs::file_time_type, fs::path>> entries;
+        uintmax_t total = 0;
+        std::error_code ec;
+        for (const auto &e : fs::directory_iterator(DIR, ec)) {
+            if (e.path().extension() != ".hull") continue;
+            total += e.file_size();
+            entries.push_back({e.last_write_time(), e.path()});
+        }
+        std::sort(entries.begin(), entries.end());
+        int removed = 0;
+        for (const auto &e : entries) {
+            if (total <= limitBytes) break;
+            if (e.second.string() == path) continue;
+            uintmax_t size = fs::file_size(e.second, ec);
+            if (fs::remove(e.second, ec)) { total -= size; removed++; }
+        }
+        return removed;
+    }
+
+    static Stats loadStats() {
+        Stats s;
+        std::ifstream fin(std::string(DIR) + "/stats.txt");
+        std::string key;
+        while (fin >> key) {
+            if (key == "hits") fin >> s.hits;
+            else if (key == "misses") fin >> s.misses;
+            else if (key == "evictions") fin >> s.evictions;
+            else if (key == "saved") fin >> s.secondsSaved;
+        }
+        return s;
+    }
+
+    static void saveStats(const Stats &s) {
+        std::ofstream fout(std::string(DIR) + "/stats.txt");
+        fout << "hits " << s.hits << "\nmisses " << s.misses << "\nevictions " << s.evictions
+             << "\nsaved " << s.secondsSaved << "\n";
+    }
+
+    // Read-modify-write of stats.txt under stats.lock. The lock file is created
+    // exclusively; one left behind by a crashed run is broken after 10 seconds.
+    template <class F>
+    void updateStats(F change) const {
+        namespace fs = std::filesystem;
+        std::string lock = std::string(DIR) + "/stats.lock";
+        std::error_code ec;
+        for (int attempt = 0; attempt < 500; ++attempt) {
+            if (std::FILE *f = std::fopen(lock.c_str(), "wx")) {
+                std::fclose(f);
+                Stats s = loadStats();
+                change(s);
+                saveStats(s);
+                fs::remove(lock, ec);
+                return;
+            }
+            auto age = fs::file_time_type::clock::now() - fs::last_write_time(lock, ec);
+            if (!ec && age > std::chrono::seconds(10)) fs::remove(lock, ec);
+            else std::this_thread::sleep_for(std::chrono::milliseconds(10));
+        }
+        std::cerr << "Warning: could not lock " << lock << ", cache statistics not updated\n";
+    }
+};
+
+#endif
@@ -1,4 +1,6 @@
-// To run code open Cmd in folder, type g++ IncRand.cpp, run executable.
+// To run code open Cmd in folder, type g++ -ffp-contract=off IncRand.cpp, run executable.
+// Run the executable with --analytics to add rotating calipers measurements to the results,
+// and/or with --cache to reuse hulls through HullCache.h.
 
 #include <algorithm>    // for sort, shuffle
 #include <unordered_set> // for unordered_set
@@ -8,6 +10,9 @@
 #include <iostream>     // for std::cout, std::cin
 #include <fstream>
 #include <chrono>
+#include "RotatingCalipers.h" // optional hull analytics
+#include "RobustPredicates.h" // exact-sign orient2d()
+#include "HullCache.h"       // optional result cache
 using namespace std;
 
 static const double EPS = 1e-9;
@@ -30,8 +35,9 @@ struct PointHash {
     }
 };
 
+// Sign is exact (adaptive precision), so it can be compared with 0 directly
 double cross(const Point &O, const Point &A, const Point &B) {
-    return (A.x - O.x) * (B.y - O.y) - (A.y - O.y) * (B.x - O.x);
+    return orient2d(O, A, B);
 }
 
 bool lexLess(const Point &a, const Point &b) {
@@ -55,12 +61,12 @@ vector<Point> monotoneChain(vector<Point> pts) {
 
     vector<Point> lower, upper;
     for (int i = 0; i < n; ++i) {
-        while (lower.size() >= 2 && cross(lower[lower.size()-2], lower.back(), pts[i]) <= EPS)
+        while (lower.size() >= 2 && cross(lower[lower.size()-2], lower.back(), pts[i]) <= 0)
             lower.pop_back();
         lower.push_back(pts[i]);
     }
     for (int i = n - 1; i >= 0; --i) {
-        while (upper.size() >= 2 && cross(upper[upper.size()-2], upper.back(), pts[i]) <= EPS)
+        while (upper.size() >= 2 && cross(upper[upper.size()-2], upper.back(), pts[i]) <= 0)
             upper.pop_back();
         upper.push_back(pts[i]);
     }
@@ -77,12 +83,38 @@ bool insideConvexHullCCW(const vector<Point> &hull, const Point &p) {
     if (n < 3) return false;
     for (int i = 0; i < n; ++i) {
         int j = (i + 1) % n;
-        if (cross(hull[i], hull[j], p) < -EPS) return false;
+        if (cross(hull[i], hull[j], p) < 0) return false;
     }
     return true;
 }
 
-// Robust incremental hull: when p is outside, rebuild hull using monotone chain on hull+{p}
+// Adds a point that is outside the CCW hull in O(h): the chain of edges p can see is
+// replaced by two edges through p. Collinear edges count as visible so no hull vertex
+// ends up in the middle of an edge.
+vector<Point> insertOutsidePoint(const vector<Point> &hull, const Point &p) {
+    int n = (int)hull.size();
+    vector<char> visible(n);
+    for (int i = 0; i < n; ++i) visible[i] = cross(hull[i], hull[(i + 1) % n], p) <= 0;
+
+    // first vertex of the visible chain: edge into it hidden, edge out of it visible
+    int start = -1;
+    for (int i = 0; i < n; ++i) {
+        if (visible[i] && !visible[(i - 1 + n) % n]) { start = i; break; }
+    }
+    if (start == -1) return hull; // p is not outside after all
+    int end = start;
+    while (visible[end]) end = (end + 1) % n;
+
+    vector<Point> updated{p};
+    for (int i = end; ; i = (i + 1) % n) {
+        updated.push_back(hull[i]);
+        if (i == start) break;
+    }
+    return updated;
+}
+
+// Randomized incremental hull. The exact predicates make every inside/outside
+// decision correct, so an outside point is spliced in rather than rebuilding the hull.
 vector<Point> incrementalHull(vector<Point> pts) {
     // Remove duplicates using hash
     unordered_set<Point, PointHash> seen;
@@ -104,10 +136,10 @@ vector<Point> incrementalHull(vector<Point> pts) {
         return uniquePts;
     }
 
-    // Initialize with 3 non-collinear points; if collinear, monotone chain will handle later
+    // Initialize with 3 points; if collinear, monotone chain will handle later
     vector<Point> init{uniquePts[0], uniquePts[1], uniquePts[2]};
     // Ensure CCW orientation for the initial triangle when non-collinear
-    if (fabs(cross(init[0], init[1], init[2])) > EPS && cross(init[0], init[1], init[2]) < 0)
+    if (cross(init[0], init[1], init[2]) < 0)
         swap(init[1], init[2]);
 
     vector<Point> hull = monotoneChain(init);
@@ -124,16 +156,21 @@ vector<Point> incrementalHull(vector<Point> pts) {
 
         if (insideConvexHullCCW(hull, p)) continue;
 
-        // Rebuild hull from current hull points plus p (guarantees correctness)
-        vector<Point> expanded = hull;
-        expanded.push_back(p);
-        hull = monotoneChain(expanded);
+        if (hull.size() >= 3) {
+            hull = insertOutsidePoint(hull, p);
+        } else {
+            // hull is still a point or segment, nothing to splice into
+            vector<Point> expanded = hull;
+            expanded.push_back(p);
+            hull = monotoneChain(expanded);
+        }
     }
     return hull;
 }
 
-int main() {
+int main(int argc, char* argv[]) {
     ios::sync_with_stdio(false);
+    bool analytics = find(argv + 1, argv + argc, string("--analytics")) != argv + argc;
     //cin.tie(nullptr);
 
     std::string filename;
@@ -175,13 +212,23 @@ int main() {
     }
     fin.close();
 
+    HullCache cache("incrand", "orient2d", cacheLimitMB(argc, argv));
+    vector<Point> hull;
     auto start = chrono::high_resolution_clock::now();
+    bool cached = cache.lookup(pts, hull);
+    auto computeStart = chrono::high_resolution_clock::now();
 
     // Compute incremental hull with robust fallback
-    vector<Point> hull = incrementalHull(pts);
+    if (!cached) hull = incrementalHull(pts);
 
     auto end = chrono::high_resolution_clock::now();
     chrono::duration<double> elapsed = end - start;
+    if (cached) {
+        op_counter = (int)cache.operations();
+        orient_calls = cache.orientCalls();
+        orient_slow = cache.orientSlow();
+    }
+    else cache.store(hull, chrono::duration<double>(end - computeStart).count(), op_counter, orient_calls, orient_slow);
 
     string file = "IncRandom_Results_" + filename;
 
@@ -195,7 +242,10 @@ int main() {
         "The Algorithm made " << op_counter << " operations.\n" <<
         "The size of the array was " << n << ". \n" <<
         "Hull computation time: " << elapsed.count() << " seconds\n" <<
-        "The points in the convex hull are: \n";
+        "Orientation tests: " << orient_calls << " (" << orient_slow << " needed exact arithmetic)\n";
+    cache.report(fout);
+    if (analytics) writeAnalytics(fout, hullAnalytics(hull)); // hull is already CCW
+    fout << "The points in the convex hull are: \n";
     for (auto &p : hull) {
         // Output in a stable order (sorted CCW by monotone chain output)
         fout << "(" << p.x << " " << p.y << ")\n";
@@ -0,0 +1,215 @@
+/*****************************************************************************
+*        Kirkpatrick-Seidel (marriage before conquest) Convex Hull code      *
+*****************************************************************************/
+// Output sensitive O(n log h) hull. Where DivideAndConquer.cpp builds both
+// sub-hulls and then merges them, this finds the bridge across the median
+// first (prune and search, linear time) and throws away every point under it
+// before recursing, so points that cannot be on the hull are never revisited.
+// Point, orientation() (exact orient2d() from RobustPredicates.h), readPoints()
+// and the results file format are the same as DivideAndConquer.cpp so the two
+// can be compared directly on low-h inputs such as Clusters/G3K.txt.
+// To run code open Cmd in folder, type g++ -ffp-contract=off KirkpatrickSeidel.cpp, run executable.
+// Run the executable with --cache to reuse hulls through HullCache.h.
+
+#include <iostream>
+#include <fstream>
+#include <vector>
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cfloat>
+#include "RobustPredicates.h"
+#include "HullCache.h"
+using namespace std;
+
+struct Point {
+    double x, y;
+};
+
+// Global operation counter
+int op_counter = 0;
+
+// Orientation test: 0=collinear, 1=counterclockwise (c left of a->b), -1=clockwise
+// Sign comes from the exact orient2d() in RobustPredicates.h, so no EPS threshold
+int orientation(const Point &a, const Point &b, const Point &c) {
+    double val = orient2d(a, b, c);
+    op_counter++;
+    if (val == 0) return 0;
+    return (val > 0 ? 1 : -1);
+}
+
+// Upper bridge across the vertical line x = a: the upper hull edge (i, j) with
+// i.x <= a < j.x. Pairs points, takes the median slope K, and uses the point
+// supporting a line of slope K to discard at least a quarter of the candidates.
+pair<Point, Point> upperBridge(vector<Point> S, double a) {
+    while (true) {
+        if (S.size() == 2) {
+            if (S[0].x > S[1].x) swap(S[0], S[1]);
+            return {S[0], S[1]};
+        }
+
+        vector<Point> candidates;
+        vector<pair<Point, Point>> pairs;
+        vector<double> slopes;
+        if (S.size() % 2) candidates.push_back(S.back());
+        for (size_t i = 0; i + 1 < S.size(); i += 2) {
+            Point p = S[i], q = S[i+1];
+            if (p.x > q.x) swap(p, q);
+            op_counter++;
+            if (p.x == q.x) candidates.push_back(p.y > q.y ? p : q); // lower one is never on the upper hull
+            else {
+                pairs.push_back({p, q});
+                slopes.push_back((q.y - p.y) / (q.x - p.x));
+            }
+        }
+        if (pairs.empty()) { S.swap(candidates); continue; }
+
+        vector<double> sorted = slopes;
+        nth_element(sorted.begin(), sorted.begin() + sorted.size()/2, sorted.end());
+        double K = sorted[sorted.size()/2];
+
+        // Points supporting a line of slope K from above. Heights that differ by
+        // less than the rounding error of p.y - K*p.x (relative to the input's
+        // own magnitude, not an absolute EPS) count as the same line.
+        double best = -INFINITY, scale = 0;
+        for (const auto &p : S) {
+            best = max(best, p.y - K*p.x);
+            scale = max(scale, fabs(p.y) + fabs(K*p.x));
+            op_counter++;
+        }
+        double tol = 4 * DBL_EPSILON * scale;
+        Point pk = {INFINITY, 0}, pm = {-INFINITY, 0};
+        for (const auto &p : S) {
+            if (p.y - K*p.x < best - tol) continue;
+            if (p.x < pk.x) pk = p;
+            if (p.x > pm.x) pm = p;
+        }
+
+        if (pk.x <= a && pm.x > a) return {pk, pm};
+
+        for (size_t i = 0; i < pairs.size(); ++i) {
+            const Point &p = pairs[i].first, &q = pairs[i].second;
+            if (pm.x <= a) {
+                // bridge slope is below K: the left point of a steeper pair is not on it
+                if (slopes[i] >= K) candidates.push_back(q);
+                else { candidates.push_back(p); candidates.push_back(q); }
+            } else {
+                // bridge slope is above K: the right point of a flatter pair is not on it
+                if (slopes[i] <= K) candidates.push_back(p);
+                else { candidates.push_back(p); candidates.push_back(q); }
+            }
+        }
+        S.swap(candidates);
+    }
+}
+
+// Upper hull from k to m (left to right); S holds k, m and the points strictly between them
+void connect(const Point &k, const Point &m, vector<Point> &S, vector<Point> &hull) {
+    // lower median x; only m has the largest x so points exist on both sides of it
+    size_t mid = (S.size() - 1) / 2;
+    nth_element(S.begin(), S.begin() + mid, S.end(), [](Point a, Point b){ return a.x < b.x; });
+    double a = S[mid].x;
+
+    pair<Point, Point> bridge = upperBridge(S, a);
+    Point i = bridge.first, j = bridge.second;
+
+    // Everything between i and j lies under the bridge and is dropped here
+    vector<Point> left{i}, right{j};
+    for (const auto &p : S) {
+        if (p.x < i.x && orientation(k, i, p) == 1) left.push_back(p);
+        else if (p.x > j.x && orientation(j, m, p) == 1) right.push_back(p);
+    }
+
+    if (i.x == k.x && i.y == k.y) hull.push_back(i);
+    else { left.push_back(k); connect(k, i, left, hull); }
+    if (j.x == m.x && j.y == m.y) hull.push_back(j);
+    else { right.push_back(m); connect(j, m, right, hull); }
+}
+
+// Upper hull left to right, including both endpoints
+vector<Point> upperHull(const vector<Point> &pts) {
+    Point k = pts[0], m = pts[0];
+    for (const auto &p : pts) {
+        op_counter++;
+        if (p.x < k.x || (p.x == k.x && p.y > k.y)) k = p;
+        if (p.x > m.x || (p.x == m.x && p.y > m.y)) m = p;
+    }
+    vector<Point> hull;
+    if (k.x == m.x) { hull.push_back(k); return hull; }
+
+    // only points above the line k-m can be on the upper hull
+    vector<Point> S{k, m};
+    for (const auto &p : pts)
+        if (p.x > k.x && p.x < m.x && orientation(k, m, p) == 1) S.push_back(p);
+
+    if (S.size() == 2) { hull.push_back(k); hull.push_back(m); return hull; }
+    connect(k, m, S, hull);
+    return hull;
+}
+
+// Kirkpatrick-Seidel convex hull, counterclockwise like divideHull()
+vector<Point> ksHull(const vector<Point> &pts) {
+    if (pts.size() <= 1) return pts;
+
+    vector<Point> upper = upperHull(pts);
+    // lower hull = upper hull of the points mirrored in the x axis
+    vector<Point> mirrored(pts);
+    for (auto &p : mirrored) p.y = -p.y;
+    vector<Point> lower = upperHull(mirrored);
+    for (auto &p : lower) p.y = -p.y;
+
+    // lower hull left to right, then upper hull right to left, without shared endpoints
+    vector<Point> hull = lower;
+    for (int i = (int)upper.size() - 1; i >= 0; --i) {
+        const Point &p = upper[i];
+        if (p.x == hull.back().x && p.y == hull.back().y) continue;
+        if (p.x == hull[0].x && p.y == hull[0].y) continue;
+        hull.push_back(p);
+    }
+    return hull;
+}
+
+// Read points from CSV
+vector<Point> readPoints(const string &filename) {
+    ifstream fin(filename);
+    vector<Point> pts;
+    if(!fin){ cerr << "Cannot open file: " << filename << endl; return pts; }
+    double x, y; char comma;
+    while(fin >> x >> comma >> y) pts.push_back({x,y});
+    return pts;
+}
+
+int main(int argc, char* argv[]) {
+    string filename;
+    cout << "Enter input .txt file: ";
+    cin >> filename;
+    vector<Point> points = readPoints(filename);
+    if(points.empty()) return 1;
+
+    HullCache cache("ks", "orient2d", cacheLimitMB(argc, argv));
+    vector<Point> hull;
+    auto start = chrono::high_resolution_clock::now();
+    bool cached = cache.lookup(points, hull);
+    auto computeStart = chrono::high_resolution_clock::now();
+    if (!cached) hull = ksHull(points);
+    auto end = chrono::high_resolution_clock::now();
+
+    chrono::duration<double> elapsed = end-start;
+    if (cached) {
+        op_counter = (int)cache.operations();
+        orient_calls = cache.orientCalls();
+        orient_slow = cache.orientSlow();
+    }
+    else cache.store(hull, chrono::duration<double>(end - computeStart).count(), op_counter, orient_calls, orient_slow);
+    string outFile = "KS_Results_" + filename;
+    ofstream fout(outFile);
+    fout << "Hull computation time: " << elapsed.count() << " seconds\n";
+    fout << "Operations: " << op_counter << "\n";
+    fout << "Orientation tests: " << orient_calls << " (" << orient_slow << " needed exact arithmetic)\n";
+    cache.report(fout);
+    fout << "Hull points:\n";
+    for(auto &p:hull) fout << p.x << "," << p.y << "\n";
+    fout.close();
+    cout << "\nResults saved to: " << outFile << endl;
+    return 0;
+}
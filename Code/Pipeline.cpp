@@ -0,0 +1,264 @@
+/*****************************************************************************
+*              Pipelined parse-and-compute Convex Hull code                  *
+*****************************************************************************/
+// The other programs read the whole file, then start the timer and build the
+// hull. Here a reader thread parses the file in chunks and hands them to worker
+// threads through a bounded queue, so parsing and hull building overlap.
+// Each worker runs monotoneChain() on every chunk it takes; the final stage
+// merges the partial hulls with one more monotoneChain() over their vertices.
+// The reported time is end-to-end (file open to final hull), next to the same
+// measurement for the plain read-then-compute approach on the same file. Each
+// mode is run twice, in the order phased, pipelined, pipelined, phased.
+// To run code open Cmd in folder, type g++ -pthread Pipeline.cpp, run executable.
+
+#include <algorithm>
+#include <vector>
+#include <string>
+#include <iostream>
+#include <fstream>
+#include <chrono>
+#include <cmath>
+#include <cstdlib>
+#include <thread>
+#include <mutex>
+#include <condition_variable>
+#include <deque>
+#include <atomic>
+using namespace std;
+
+static const double EPS = 1e-9;
+atomic<long long> op_counter(0);
+
+// number of points handed to a worker at a time
+static const size_t CHUNK_POINTS = 1 << 16;
+// chunks allowed to wait in the queue before the reader blocks
+static const size_t QUEUE_CAPACITY = 8;
+
+struct Point {
+    double x, y;
+
+    bool operator==(const Point &other) const {
+        return fabs(x - other.x) < EPS && fabs(y - other.y) < EPS;
+    }
+};
+
+double cross(const Point &O, const Point &A, const Point &B) {
+    return (A.x - O.x) * (B.y - O.y) - (A.y - O.y) * (B.x - O.x);
+}
+
+bool lexLess(const Point &a, const Point &b) {
+    if (fabs(a.x - b.x) > EPS) return a.x < b.x;
+    return a.y < b.y - EPS;
+}
+
+// Andrew's monotone chain convex hull (returns CCW hull without duplicate last point)
+vector<Point> monotoneChain(vector<Point> pts) {
+    if (pts.size() <= 1) return pts;
+    sort(pts.begin(), pts.end(), lexLess);
+    // Remove near-duplicates post-sort
+    vector<Point> uniq;
+    uniq.reserve(pts.size());
+    for (auto &p : pts) {
+        if (uniq.empty() || !(p == uniq.back())) uniq.push_back(p);
+    }
+    pts.swap(uniq);
+    int n = (int)pts.size();
+    if (n <= 1) return pts;
+
+    long long ops = 0;
+    vector<Point> lower, upper;
+    for (int i = 0; i < n; ++i) {
+        while (lower.size() >= 2 && (++ops, cross(lower[lower.size()-2], lower.back(), pts[i]) <= EPS))
+            lower.pop_back();
+        lower.push_back(pts[i]);
+    }
+    for (int i = n - 1; i >= 0; --i) {
+        while (upper.size() >= 2 && (++ops, cross(upper[upper.size()-2], upper.back(), pts[i]) <= EPS))
+            upper.pop_back();
+        upper.push_back(pts[i]);
+    }
+    op_counter += ops;
+    // Concatenate, removing duplicate endpoints
+    lower.pop_back();
+    upper.pop_back();
+    lower.insert(lower.end(), upper.begin(), upper.end());
+    return lower;
+}
+
+// Blocking queue of parsed chunks; push waits while full, pop returns false once closed and drained
+class ChunkQueue {
+public:
+    explicit ChunkQueue(size_t capacity) : capacity(capacity) {}
+
+    // Returns the seconds spent waiting for room; lock contention is not counted
+    double push(vector<Point> chunk) {
+        unique_lock<mutex> lock(m);
+        double waited = 0;
+        if (q.size() >= capacity) {
+            auto t0 = chrono::high_resolution_clock::now();
+            notFull.wait(lock, [&]{ return q.size() < capacity; });
+            waited = chrono::duration<double>(chrono::high_resolution_clock::now() - t0).count();
+        }
+        q.push_back(std::move(chunk));
+        notEmpty.notify_one();
+        return waited;
+    }
+
+    bool pop(vector<Point> &chunk) {
+        unique_lock<mutex> lock(m);
+        notEmpty.wait(lock, [&]{ return !q.empty() || closed; });
+        if (q.empty()) return false;
+        chunk = std::move(q.front());
+        q.pop_front();
+        notFull.notify_one();
+        return true;
+    }
+
+    void close() {
+        lock_guard<mutex> lock(m);
+        closed = true;
+        notEmpty.notify_all();
+    }
+
+private:
+    size_t capacity;
+    deque<vector<Point>> q;
+    bool closed = false;
+    mutex m;
+    condition_variable notFull, notEmpty;
+};
+
+// Parse one "x,y" line; returns false on malformed lines
+bool parseLine(const string &line, Point &p) {
+    const char *s = line.c_str();
+    char *end;
+    p.x = strtod(s, &end);
+    if (end == s) return false;
+    while (*end == ' ' || *end == '\t') ++end;
+    if (*end != ',') return false;
+    s = end + 1;
+    p.y = strtod(s, &end);
+    return end != s;
+}
+
+struct PipelineStats {
+    size_t points = 0;
+    size_t chunks = 0;
+    double readerStall = 0; // seconds the reader waited on a full queue
+    double mergeTime = 0;   // seconds spent in the final merge
+};
+
+vector<Point> pipelinedHull(const string &filename, int workers, PipelineStats &stats) {
+    ifstream fin(filename);
+    if (!fin) { cerr << "Cannot open file: " << filename << endl; return {}; }
+
+    ChunkQueue queue(QUEUE_CAPACITY);
+    vector<Point> partials;
+    mutex partialsMutex;
+
+    vector<thread> pool;
+    for (int w = 0; w < workers; ++w) {
+        pool.emplace_back([&]{
+            vector<Point> chunk;
+            while (queue.pop(chunk)) {
+                vector<Point> h = monotoneChain(std::move(chunk));
+                lock_guard<mutex> lock(partialsMutex);
+                partials.insert(partials.end(), h.begin(), h.end());
+            }
+        });
+    }
+
+    // Reader stage runs on this thread
+    string line;
+    vector<Point> chunk;
+    chunk.reserve(CHUNK_POINTS);
+    while (getline(fin, line)) {
+        Point p;
+        if (!parseLine(line, p)) continue;
+        chunk.push_back(p);
+        if (chunk.size() == CHUNK_POINTS) {
+            stats.points += chunk.size();
+            stats.chunks++;
+            stats.readerStall += queue.push(std::move(chunk));
+            chunk = vector<Point>();
+            chunk.reserve(CHUNK_POINTS);
+        }
+    }
+    if (!chunk.empty()) {
+        stats.points += chunk.size();
+        stats.chunks++;
+        stats.readerStall += queue.push(std::move(chunk));
+    }
+    queue.close();
+    for (auto &t : pool) t.join();
+
+    auto m0 = chrono::high_resolution_clock::now();
+    vector<Point> hull = monotoneChain(partials);
+    stats.mergeTime = chrono::duration<double>(chrono::high_resolution_clock::now() - m0).count();
+    return hull;
+}
+
+// Read-everything-then-compute baseline, matching the other programs
+vector<Point> phasedHull(const string &filename, double &hullOnly) {
+    ifstream fin(filename);
+    vector<Point> pts;
+    string line;
+    while (getline(fin, line)) {
+        Point p;
+        if (parseLine(line, p)) pts.push_back(p);
+    }
+    auto t0 = chrono::high_resolution_clock::now();
+    vector<Point> hull = monotoneChain(pts);
+    hullOnly = chrono::duration<double>(chrono::high_resolution_clock::now() - t0).count();
+    return hull;
+}
+
+int main() {
+    string filename;
+    int workers;
+    cout << "Enter input .txt file: ";
+    cin >> filename;
+    cout << "Worker threads (0 = auto): ";
+    cin >> workers;
+    if (!cin || workers <= 0) workers = max(1, (int)thread::hardware_concurrency() - 1);
+
+    // Runs go phased, pipelined, pipelined, phased so neither mode always gets
+    // the cold page cache; both runs of each are reported.
+    double phasedHullOnly[2], phasedTime[2], pipelineTime[2];
+    auto timed = [](auto run) {
+        auto start = chrono::high_resolution_clock::now();
+        run();
+        return chrono::duration<double>(chrono::high_resolution_clock::now() - start).count();
+    };
+    vector<Point> phased, hull;
+    phasedTime[0] = timed([&] { phased = phasedHull(filename, phasedHullOnly[0]); });
+
+    PipelineStats stats, repeatStats;
+    long long opsBefore = op_counter;
+    pipelineTime[0] = timed([&] { hull = pipelinedHull(filename, workers, stats); });
+    if (stats.points == 0) { cerr << "No points read from file. Exiting.\n"; return 1; }
+    long long pipelineOps = op_counter - opsBefore;
+    pipelineTime[1] = timed([&] { pipelinedHull(filename, workers, repeatStats); });
+    phasedTime[1] = timed([&] { phasedHull(filename, phasedHullOnly[1]); });
+
+    string outFile = "Pipeline_Results_" + filename;
+    ofstream fout(outFile);
+    if (!fout) { cerr << "Failed to open " << outFile << " for writing\n"; return 1; }
+
+    for (ostream *os : {(ostream *)&cout, (ostream *)&fout}) {
+        *os << hull.size() << " point hull size.\n";
+        *os << "The Algorithm made " << pipelineOps << " operations.\n";
+        *os << "The size of the array was " << stats.points << ".\n";
+        *os << "End-to-end time: " << pipelineTime[0] << " / " << pipelineTime[1] << " seconds ("
+            << stats.chunks << " chunks, " << workers << " workers)\n";
+        *os << "Reader stalled on full queue: " << stats.readerStall << " / " << repeatStats.readerStall << " seconds\n";
+        *os << "Final merge time: " << stats.mergeTime << " / " << repeatStats.mergeTime << " seconds\n";
+        *os << "Phased end-to-end time: " << phasedTime[0] << " / " << phasedTime[1] << " seconds (hull only "
+            << phasedHullOnly[0] << " / " << phasedHullOnly[1] << " seconds, " << phased.size() << " point hull)\n";
+    }
+    fout << "The points in the convex hull are:\n";
+    for (auto &p : hull) fout << "(" << p.x << ", " << p.y << ")\n";
+    fout.close();
+    cout << "Results saved to: " << outFile << endl;
+    return 0;
+}
@@ -0,0 +1,209 @@
+/*****************************************************************************
+*              Robust adaptive-precision orientation test (header)           *
+*****************************************************************************/
+// orient2d() after Jonathan Shewchuk's "Adaptive Precision Floating-Point
+// Arithmetic and Fast Robust Geometric Predicates" (predicates.c, public domain).
+// It returns a value whose sign is always the exact sign of
+//   (b.x - a.x)*(c.y - a.y) - (b.y - a.y)*(c.x - a.x)
+// positive when a, b, c turn counterclockwise, negative when clockwise and
+// exactly 0 when collinear, so callers no longer need an EPS threshold.
+// The plain double formula is used whenever a forward error bound proves its
+// sign is right; only near-collinear triples fall through to the slower exact
+// expansion arithmetic. orient_calls and orient_slow count how often that is.
+// Needs IEEE double arithmetic: do not compile with -ffast-math. Contracting
+// multiplies and adds into FMA is fine (twoProduct() then uses std::fma), but
+// on compilers that do it without defining FP_FAST_FMA add -ffp-contract=off.
+
+#ifndef ROBUST_PREDICATES_H
+#define ROBUST_PREDICATES_H
+
+#include <cmath>
+
+inline long long orient_calls = 0; // every orient2d() call
+inline long long orient_slow = 0;  // calls the error bound filter could not decide
+
+namespace robust {
+
+const double epsilon = 1.1102230246251565e-16;   // 2^-53, half an ulp of 1.0
+const double splitter = 134217729.0;             // 2^27 + 1
+const double resulterrbound = (3.0 + 8.0 * epsilon) * epsilon;
+const double ccwerrboundA = (3.0 + 16.0 * epsilon) * epsilon;
+const double ccwerrboundB = (2.0 + 12.0 * epsilon) * epsilon;
+const double ccwerrboundC = (9.0 + 64.0 * epsilon) * epsilon * epsilon;
+
+// Error-free transformations: x is the rounded result, y the exact roundoff
+inline void fastTwoSum(double a, double b, double &x, double &y) {
+    x = a + b;
+    double bvirt = x - a;
+    y = b - bvirt;
+}
+
+inline void twoSum(double a, double b, double &x, double &y) {
+    x = a + b;
+    double bvirt = x - a;
+    double avirt = x - bvirt;
+    y = (a - avirt) + (b - bvirt);
+}
+
+inline void twoDiffTail(double a, double b, double x, double &y) {
+    double bvirt = a - x;
+    double avirt = x + bvirt;
+    y = (a - avirt) + (bvirt - b);
+}
+
+inline void twoDiff(double a, double b, double &x, double &y) {
+    x = a - b;
+    twoDiffTail(a, b, x, y);
+}
+
+inline void split(double a, double &hi, double &lo) {
+    double c = splitter * a;
+    double abig = c - a;
+    hi = c - abig;
+    lo = a - hi;
+}
+
+// With a hardware FMA the roundoff of a*b is fma(a, b, -x) exactly. Dekker's
+// split below is only exact if no multiply and subtract in it are fused, and
+// compilers fuse them whenever FMA is available (GCC with -mfma or on aarch64,
+// Clang within one expression), so the FMA path must be taken there.
+inline void twoProduct(double a, double b, double &x, double &y) {
+    x = a * b;
+#ifdef FP_FAST_FMA
+    y = std::fma(a, b, -x);
+#else
+    double ahi, alo, bhi, blo;
+    split(a, ahi, alo);
+    split(b, bhi, blo);
+    double err1 = x - (ahi * bhi);
+    double err2 = err1 - (alo * bhi);
+    double err3 = err2 - (ahi * blo);
+    y = (alo * blo) - err3;
+#endif
+}
+
+// (a1 + a0) - (b1 + b0) as a four component expansion x[3] + x[2] + x[1] + x[0]
+inline void twoTwoDiff(double a1, double a0, double b1, double b0, double x[4]) {
+    double i, j, k;
+    twoDiff(a0, b0, i, x[0]);
+    twoSum(a1, i, j, k);
+    twoDiff(k, b1, i, x[1]);
+    twoSum(j, i, x[3], x[2]);
+}
+
+// h = e + f for nonoverlapping expansions, zero components removed; returns length of h
+inline int expansionSum(int elen, const double *e, int flen, const double *f, double *h) {
+    int eindex = 0, findex = 0, hindex = 0;
+    double Q, Qnew, hh;
+    double enow = e[0], fnow = f[0];
+    if ((fnow > enow) == (fnow > -enow)) { Q = enow; if (++eindex < elen) enow = e[eindex]; }
+    else { Q = fnow; if (++findex < flen) fnow = f[findex]; }
+    if (eindex < elen && findex < flen) {
+        if ((fnow > enow) == (fnow > -enow)) { fastTwoSum(enow, Q, Qnew, hh); if (++eindex < elen) enow = e[eindex]; }
+        else { fastTwoSum(fnow, Q, Qnew, hh); if (++findex < flen) fnow = f[findex]; }
+        Q = Qnew;
+        if (hh != 0.0) h[hindex++] = hh;
+        while (eindex < elen && findex < flen) {
+            if ((fnow > enow) == (fnow > -enow)) { twoSum(Q, enow, Qnew, hh); if (++eindex < elen) enow = e[eindex]; }
+            else { twoSum(Q, fnow, Qnew, hh); if (++findex < flen) fnow = f[findex]; }
+            Q = Qnew;
+            if (hh != 0.0) h[hindex++] = hh;
+        }
+    }
+    while (eindex < elen) {
+        twoSum(Q, enow, Qnew, hh);
+        if (++eindex < elen) enow = e[eindex];
+        Q = Qnew;
+        if (hh != 0.0) h[hindex++] = hh;
+    }
+    while (findex < flen) {
+        twoSum(Q, fnow, Qnew, hh);
+        if (++findex < flen) fnow = f[findex];
+        Q = Qnew;
+        if (hh != 0.0) h[hindex++] = hh;
+    }
+    if (Q != 0.0 || hindex == 0) h[hindex++] = Q;
+    return hindex;
+}
+
+inline double estimate(int elen, const double *e) {
+    double Q = e[0];
+    for (int i = 1; i < elen; ++i) Q += e[i];
+    return Q;
+}
+
+// Slow path: exact where needed, stopping as soon as the sign is certain
+inline double orient2dAdapt(double ax, double ay, double bx, double by, double cx, double cy, double detsum) {
+    double acx = ax - cx, bcx = bx - cx, acy = ay - cy, bcy = by - cy;
+
+    double detleft, detlefttail, detright, detrighttail;
+    twoProduct(acx, bcy, detleft, detlefttail);
+    twoProduct(acy, bcx, detright, detrighttail);
+    double B[4];
+    twoTwoDiff(detleft, detlefttail, detright, detrighttail, B);
+
+    double det = estimate(4, B);
+    double errbound = ccwerrboundB * detsum;
+    if (det >= errbound || -det >= errbound) return det;
+
+    double acxtail, bcxtail, acytail, bcytail;
+    twoDiffTail(ax, cx, acx, acxtail);
+    twoDiffTail(bx, cx, bcx, bcxtail);
+    twoDiffTail(ay, cy, acy, acytail);
+    twoDiffTail(by, cy, bcy, bcytail);
+    if (acxtail == 0.0 && acytail == 0.0 && bcxtail == 0.0 && bcytail == 0.0) return det;
+
+    errbound = ccwerrboundC * detsum + resulterrbound * std::fabs(det);
+    det += (acx * bcytail + bcy * acxtail) - (acy * bcxtail + bcx * acytail);
+    if (det >= errbound || -det >= errbound) return det;
+
+    double s1, s0, t1, t0, u[4];
+    double C1[8], C2[12], D[16];
+    twoProduct(acxtail, bcy, s1, s0);
+    twoProduct(acytail, bcx, t1, t0);
+    twoTwoDiff(s1, s0, t1, t0, u);
+    int C1length = expansionSum(4, B, 4, u, C1);
+
+    twoProduct(acx, bcytail, s1, s0);
+    twoProduct(acy, bcxtail, t1, t0);
+    twoTwoDiff(s1, s0, t1, t0, u);
+    int C2length = expansionSum(C1length, C1, 4, u, C2);
+
+    twoProduct(acxtail, bcytail, s1, s0);
+    twoProduct(acytail, bcxtail, t1, t0);
+    twoTwoDiff(s1, s0, t1, t0, u);
+    int Dlength = expansionSum(C2length, C2, 4, u, D);
+
+    return D[Dlength - 1];
+}
+
+} // namespace robust
+
+// Positive if a, b, c are counterclockwise, negative if clockwise, 0 if collinear.
+// Works on any point struct with double x, y members.
+template <class P>
+double orient2d(const P &a, const P &b, const P &c) {
+    orient_calls++;
+    double detleft = (a.x - c.x) * (b.y - c.y);
+    double detright = (a.y - c.y) * (b.x - c.x);
+    double det = detleft - detright;
+    double detsum;
+
+    if (detleft > 0.0) {
+        if (detright <= 0.0) return det;
+        detsum = detleft + detright;
+    } else if (detleft < 0.0) {
+        if (detright >= 0.0) return det;
+        detsum = -detleft - detright;
+    } else {
+        return det;
+    }
+
+    double errbound = robust::ccwerrboundA * detsum;
+    if (det >= errbound || -det >= errbound) return det;
+
+    orient_slow++;
+    return robust::orient2dAdapt(a.x, a.y, b.x, b.y, c.x, c.y, detsum);
+}
+
+#endif
@@ -0,0 +1,173 @@
+/*****************************************************************************
+*                   Rotating Calipers hull analytics (header)                *
+*****************************************************************************/
+// Measures a finished convex hull in O(h): area, perimeter, centroid,
+// diameter, width, and the minimum-area and minimum-perimeter enclosing
+// rectangles. Works on any point struct with double x, y members, so it can be
+// included by GiftWrap.cpp, DivideAndConquer.cpp and IncRand.cpp as they are.
+// Call hullAnalytics() with the hull vertices in order (CW or CCW) and print
+// the result with writeAnalytics().
+
+#ifndef ROTATING_CALIPERS_H
+#define ROTATING_CALIPERS_H
+
+#include <vector>
+#include <algorithm>
+#include <ostream>
+#include <cmath>
+
+struct HullAnalytics {
+    int vertices = 0;          // strictly convex vertices used for the measurements
+    double area = 0, perimeter = 0;
+    double cx = 0, cy = 0;     // centroid of the hull region
+    double diameter = 0;       // largest distance between two hull points
+    double width = 0;          // smallest distance between two parallel supporting lines
+    double minAreaRect = 0, minAreaRectW = 0, minAreaRectH = 0;
+    double minPerimRect = 0, minPerimRectW = 0, minPerimRectH = 0;
+};
+
+namespace calipers {
+
+struct Vec { double x, y; };
+
+inline double cross(const Vec &o, const Vec &a, const Vec &b) {
+    return (a.x - o.x) * (b.y - o.y) - (a.y - o.y) * (b.x - o.x);
+}
+
+// Fallback for input that is not a clean convex polygon: Andrew's monotone chain
+inline std::vector<Vec> rebuild(std::vector<Vec> pts) {
+    std::sort(pts.begin(), pts.end(), [](const Vec &a, const Vec &b) {
+        return a.x < b.x || (a.x == b.x && a.y < b.y);
+    });
+    pts.erase(std::unique(pts.begin(), pts.end(), [](const Vec &a, const Vec &b) {
+        return a.x == b.x && a.y == b.y;
+    }), pts.end());
+    if (pts.size() < 3) return pts;
+    std::vector<Vec> h(2 * pts.size());
+    size_t k = 0;
+    for (size_t i = 0; i < pts.size(); ++i) {
+        while (k >= 2 && cross(h[k-2], h[k-1], pts[i]) <= 0) k--;
+        h[k++] = pts[i];
+    }
+    for (size_t i = pts.size() - 1, t = k + 1; i > 0; --i) {
+        while (k >= t && cross(h[k-2], h[k-1], pts[i-1]) <= 0) k--;
+        h[k++] = pts[i-1];
+    }
+    h.resize(k - 1);
+    return h;
+}
+
+// Orients the hull CCW and drops repeated and collinear vertices in O(h).
+// If what is left is not convex the vertices are rebuilt into a hull.
+inline std::vector<Vec> strictCCW(std::vector<Vec> h) {
+    double twiceArea = 0;
+    for (size_t i = 0; i < h.size(); ++i) {
+        const Vec &a = h[i], &b = h[(i + 1) % h.size()];
+        twiceArea += a.x * b.y - b.x * a.y;
+    }
+    if (twiceArea < 0) std::reverse(h.begin(), h.end());
+
+    std::vector<Vec> out;
+    for (const Vec &p : h) {
+        while (out.size() >= 2 && cross(out[out.size()-2], out.back(), p) == 0) out.pop_back();
+        if (!out.empty() && out.back().x == p.x && out.back().y == p.y) continue;
+        out.push_back(p);
+    }
+    // the wrap-around can leave collinear points at either end
+    while (out.size() >= 3 && cross(out[out.size()-2], out.back(), out[0]) == 0) out.pop_back();
+    while (out.size() >= 3 && cross(out.back(), out[0], out[1]) == 0) out.erase(out.begin());
+    if (out.size() >= 2 && out.back().x == out[0].x && out.back().y == out[0].y) out.pop_back();
+
+    for (size_t i = 0; i < out.size() && out.size() >= 3; ++i) {
+        if (cross(out[i], out[(i + 1) % out.size()], out[(i + 2) % out.size()]) < 0) return rebuild(h);
+    }
+    return out;
+}
+
+inline double dist(const Vec &a, const Vec &b) { return std::hypot(a.x - b.x, a.y - b.y); }
+
+} // namespace calipers
+
+template <class P>
+HullAnalytics hullAnalytics(const std::vector<P> &hull) {
+    using namespace calipers;
+    std::vector<Vec> v;
+    v.reserve(hull.size());
+    for (const auto &p : hull) v.push_back({(double)p.x, (double)p.y});
+    v = strictCCW(v);
+
+    HullAnalytics r;
+    int n = (int)v.size();
+    r.vertices = n;
+    if (n == 0) return r;
+    if (n == 1) { r.cx = v[0].x; r.cy = v[0].y; return r; }
+    if (n == 2) {
+        // a segment: zero width, every enclosing rectangle degenerates to it
+        double len = dist(v[0], v[1]);
+        r.perimeter = 2 * len;
+        r.cx = (v[0].x + v[1].x) / 2; r.cy = (v[0].y + v[1].y) / 2;
+        r.diameter = len;
+        r.minAreaRectW = r.minPerimRectW = len;
+        r.minPerimRect = 2 * len;
+        return r;
+    }
+
+    // Area, perimeter and centroid from the shoelace formula
+    double a2 = 0, sx = 0, sy = 0;
+    for (int i = 0; i < n; ++i) {
+        const Vec &p = v[i], &q = v[(i + 1) % n];
+        double c = p.x * q.y - q.x * p.y;
+        a2 += c;
+        sx += (p.x + q.x) * c;
+        sy += (p.y + q.y) * c;
+        r.perimeter += dist(p, q);
+    }
+    r.area = a2 / 2;
+    r.cx = sx / (3 * a2);
+    r.cy = sy / (3 * a2);
+
+    // Diameter: antipodal pairs, one caliper per edge
+    int j = 1;
+    for (int i = 0; i < n; ++i) {
+        const Vec &p = v[i], &q = v[(i + 1) % n];
+        while (cross(p, q, v[(j + 1) % n]) > cross(p, q, v[j])) j = (j + 1) % n;
+        r.diameter = std::max({r.diameter, dist(p, v[j]), dist(q, v[j])});
+    }
+
+    // Width and rectangles: for every edge direction track the farthest point
+    // (height), and the extreme points forward and backward along the edge
+    r.width = INFINITY;
+    r.minAreaRect = r.minPerimRect = INFINITY;
+    int far = 1, fwd = 1, back = -1;
+    for (int i = 0; i < n; ++i) {
+        const Vec &p = v[i], &q = v[(i + 1) % n];
+        double ex = q.x - p.x, ey = q.y - p.y, len = std::hypot(ex, ey);
+        ex /= len; ey /= len;
+        auto along = [&](int k) { return (v[k].x - p.x) * ex + (v[k].y - p.y) * ey; };
+        auto height = [&](int k) { return (v[k].x - p.x) * -ey + (v[k].y - p.y) * ex; };
+
+        while ((far + 1) % n != i && height((far + 1) % n) >= height(far)) far = (far + 1) % n;
+        while ((fwd + 1) % n != i && along((fwd + 1) % n) >= along(fwd)) fwd = (fwd + 1) % n;
+        if (back < 0) back = far; // the backward extreme lies between the far point and p
+        while (back != i && along((back + 1) % n) <= along(back)) back = (back + 1) % n;
+
+        double h = height(far);
+        double w = along(fwd) - along(back);
+        r.width = std::min(r.width, h);
+        if (w * h < r.minAreaRect) { r.minAreaRect = w * h; r.minAreaRectW = w; r.minAreaRectH = h; }
+        if (2 * (w + h) < r.minPerimRect) { r.minPerimRect = 2 * (w + h); r.minPerimRectW = w; r.minPerimRectH = h; }
+    }
+    return r;
+}
+
+inline void writeAnalytics(std::ostream &os, const HullAnalytics &r) {
+    os << "Hull area: " << r.area << "\n";
+    os << "Hull perimeter: " << r.perimeter << "\n";
+    os << "Hull centroid: (" << r.cx << ", " << r.cy << ")\n";
+    os << "Diameter: " << r.diameter << "\n";
+    os << "Width: " << r.width << "\n";
+    os << "Min-area rectangle: " << r.minAreaRect << " (" << r.minAreaRectW << " x " << r.minAreaRectH << ")\n";
+    os << "Min-perimeter rectangle: " << r.minPerimRect << " (" << r.minPerimRectW << " x " << r.minPerimRectH << ")\n";
+}
+
+#endif
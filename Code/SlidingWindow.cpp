@@ -0,0 +1,310 @@
+/*****************************************************************************
+*                  Sliding Window Convex Hull (streaming) code               *
+*****************************************************************************/
+// Keeps the hull of the last W points (or the last W seconds) of a point
+// stream without recomputing from scratch on every tick.
+// The window is split into blocks of B points, each holding the hull of its
+// live points. The newest block's hull grows one point at a time; the hulls of
+// the full blocks between the oldest and the newest are kept merged into one
+// middle hull, rebuilt only when a block fills up or expires (every B points).
+// Expiring a point only touches the oldest block, and only rebuilds its hull
+// when the expired point was one of its vertices. Memory is O(W), and every
+// merge is a linear pass over hulls that are already in sorted order.
+//
+// Input lines are "x,y" (timestamp = line number) or "t,x,y".
+// To run code open Cmd in folder, type g++ SlidingWindow.cpp, run executable with
+//   ./a.out <W> [points|seconds] [file] [B]    (no file or "-" reads from stdin)
+// B defaults to sqrt(W) for point windows and 64 for time windows.
+
+#include <algorithm>
+#include <vector>
+#include <string>
+#include <iostream>
+#include <fstream>
+#include <chrono>
+#include <cmath>
+#include <deque>
+using namespace std;
+
+static const double EPS = 1e-9;
+long long op_counter = 0;
+
+struct Point {
+    double x, y;
+
+    bool operator==(const Point &other) const {
+        return fabs(x - other.x) < EPS && fabs(y - other.y) < EPS;
+    }
+};
+
+double cross(const Point &O, const Point &A, const Point &B) {
+    op_counter++;
+    return (A.x - O.x) * (B.y - O.y) - (A.y - O.y) * (B.x - O.x);
+}
+
+bool lexLess(const Point &a, const Point &b) {
+    if (fabs(a.x - b.x) > EPS) return a.x < b.x;
+    return a.y < b.y - EPS;
+}
+
+// Monotone chain pass over points already in lexLess order without duplicates
+vector<Point> chainSorted(const vector<Point> &pts) {
+    int n = (int)pts.size();
+    if (n <= 1) return pts;
+
+    vector<Point> lower, upper;
+    for (int i = 0; i < n; ++i) {
+        while (lower.size() >= 2 && cross(lower[lower.size()-2], lower.back(), pts[i]) <= EPS)
+            lower.pop_back();
+        lower.push_back(pts[i]);
+    }
+    for (int i = n - 1; i >= 0; --i) {
+        while (upper.size() >= 2 && cross(upper[upper.size()-2], upper.back(), pts[i]) <= EPS)
+            upper.pop_back();
+        upper.push_back(pts[i]);
+    }
+    // Concatenate, removing duplicate endpoints
+    lower.pop_back();
+    upper.pop_back();
+    lower.insert(lower.end(), upper.begin(), upper.end());
+    return lower;
+}
+
+// Andrew's monotone chain convex hull (returns CCW hull without duplicate last point)
+vector<Point> monotoneChain(vector<Point> pts) {
+    if (pts.size() <= 1) return pts;
+    sort(pts.begin(), pts.end(), lexLess);
+    // Remove near-duplicates post-sort
+    vector<Point> uniq;
+    uniq.reserve(pts.size());
+    for (auto &p : pts) {
+        if (uniq.empty() || !(p == uniq.back())) uniq.push_back(p);
+    }
+    return chainSorted(uniq);
+}
+
+// Vertices of a CCW hull in lexLess order, O(h): the lower chain runs from the
+// lexicographically smallest vertex to the largest, the upper chain back again
+vector<Point> lexOrder(const vector<Point> &hull) {
+    int n = (int)hull.size();
+    if (n <= 2) {
+        vector<Point> small = hull;
+        sort(small.begin(), small.end(), lexLess);
+        return small;
+    }
+    int lo = 0, hi = 0;
+    for (int i = 1; i < n; ++i) {
+        if (lexLess(hull[i], hull[lo])) lo = i;
+        if (lexLess(hull[hi], hull[i])) hi = i;
+    }
+    vector<Point> lower, upper;
+    for (int i = lo; ; i = (i + 1) % n) { lower.push_back(hull[i]); if (i == hi) break; }
+    for (int i = lo; ; i = (i - 1 + n) % n) { if (i != lo && i != hi) upper.push_back(hull[i]); if (i == hi) break; }
+    vector<Point> sorted(lower.size() + upper.size());
+    merge(lower.begin(), lower.end(), upper.begin(), upper.end(), sorted.begin(), lexLess);
+    return sorted;
+}
+
+// Hull of the union of several CCW hulls in O(total size), no sorting needed
+vector<Point> mergeSortedHulls(initializer_list<const vector<Point> *> hulls) {
+    vector<Point> both, part;
+    for (const vector<Point> *h : hulls) {
+        vector<Point> sorted = lexOrder(*h);
+        part.resize(both.size() + sorted.size());
+        merge(both.begin(), both.end(), sorted.begin(), sorted.end(), part.begin(), lexLess);
+        both.swap(part);
+    }
+    vector<Point> uniq;
+    uniq.reserve(both.size());
+    for (auto &p : both) {
+        if (uniq.empty() || !(p == uniq.back())) uniq.push_back(p);
+    }
+    return chainSorted(uniq);
+}
+
+// Point-in-convex-polygon test for CCW hull; returns true if inside or on boundary
+bool insideConvexHullCCW(const vector<Point> &hull, const Point &p) {
+    int n = (int)hull.size();
+    if (n < 3) return false;
+    for (int i = 0; i < n; ++i) {
+        int j = (i + 1) % n;
+        if (cross(hull[i], hull[j], p) < -EPS) return false;
+    }
+    return true;
+}
+
+// Hull of hull+{p}; only changes when p is outside
+vector<Point> addPoint(const vector<Point> &hull, const Point &p) {
+    if (insideConvexHullCCW(hull, p)) return hull;
+    vector<Point> single{p};
+    return mergeSortedHulls({&hull, &single});
+}
+
+struct Sample {
+    double t;
+    Point p;
+};
+
+struct Block {
+    vector<Sample> samples;
+    size_t head = 0;    // samples before head have expired
+    vector<Point> hull; // hull of samples[head..]
+};
+
+class WindowHull {
+public:
+    explicit WindowHull(size_t blockSize) : blockSize(max<size_t>(1, blockSize)) {}
+
+    void push(double t, const Point &p) {
+        if (blocks.empty() || blocks.back().samples.size() == blockSize) {
+            // the full newest block joins the middle unless it is also the oldest
+            if (blocks.size() >= 2) middleHull = mergeSortedHulls({&middleHull, &blocks.back().hull});
+            blocks.emplace_back();
+            blocks.back().samples.reserve(blockSize);
+        }
+        Block &b = blocks.back();
+        b.samples.push_back({t, p});
+        b.hull = addPoint(b.hull, p);
+        count++;
+    }
+
+    // Expire the oldest sample
+    void pop() {
+        if (blocks.empty()) return;
+        Block &f = blocks.front();
+        Point expired = f.samples[f.head++].p;
+        count--;
+        if (f.head == f.samples.size()) {
+            blocks.pop_front();
+            rebuildMiddle();
+        } else if (find(f.hull.begin(), f.hull.end(), expired) != f.hull.end()) {
+            // only a lost vertex changes the block's hull
+            vector<Point> live;
+            live.reserve(f.samples.size() - f.head);
+            for (size_t i = f.head; i < f.samples.size(); ++i) live.push_back(f.samples[i].p);
+            f.hull = monotoneChain(live);
+        }
+    }
+
+    double oldestTime() const {
+        return blocks.empty() ? INFINITY : blocks.front().samples[blocks.front().head].t;
+    }
+
+    size_t size() const { return count; }
+
+    vector<Point> hull() const {
+        if (blocks.empty()) return {};
+        if (blocks.size() == 1) return blocks.front().hull;
+        return mergeSortedHulls({&blocks.front().hull, &middleHull, &blocks.back().hull});
+    }
+
+private:
+    size_t blockSize;
+    size_t count = 0;
+    deque<Block> blocks;     // oldest first; only the newest block is still filling
+    vector<Point> middleHull; // hull of every block except the oldest and the newest
+
+    void rebuildMiddle() {
+        middleHull.clear();
+        for (size_t i = 1; i + 1 < blocks.size(); ++i) middleHull = mergeSortedHulls({&middleHull, &blocks[i].hull});
+    }
+};
+
+// Parse "x,y" or "t,x,y"; returns false on malformed lines
+bool parseSample(const string &line, double defaultT, double &t, Point &p) {
+    vector<double> vals;
+    size_t pos = 0;
+    while (pos <= line.size() && vals.size() < 3) {
+        size_t comma = line.find(',', pos);
+        string tok = line.substr(pos, comma == string::npos ? string::npos : comma - pos);
+        try { vals.push_back(stod(tok)); } catch (...) { return false; }
+        if (comma == string::npos) break;
+        pos = comma + 1;
+    }
+    if (vals.size() == 2) { t = defaultT; p = {vals[0], vals[1]}; return true; }
+    if (vals.size() == 3) { t = vals[0]; p = {vals[1], vals[2]}; return true; }
+    return false;
+}
+
+double percentile(const vector<double> &sorted, double q) {
+    if (sorted.empty()) return 0;
+    size_t idx = (size_t)(q * (sorted.size() - 1) + 0.5);
+    return sorted[idx];
+}
+
+int main(int argc, char* argv[]) {
+    ios::sync_with_stdio(false);
+    if (argc < 2) {
+        cout << "Usage: ./a.out <W> [points|seconds] [file] [B]\n";
+        return 1;
+    }
+    double W = stod(argv[1]);
+    bool byTime = (argc >= 3 && string(argv[2]) == "seconds");
+    string filename = (argc >= 4) ? argv[3] : "-";
+    if (W <= 0) { cerr << "W must be positive\n"; return 1; }
+    size_t blockSize = (argc >= 5) ? (size_t)stoul(argv[4]) : byTime ? 64 : (size_t)max(1.0, sqrt(W));
+
+    ifstream fin;
+    if (filename != "-") {
+        fin.open(filename);
+        if (!fin) { cerr << "Failed to open " << filename << "\n"; return 1; }
+    }
+    istream &in = (filename == "-") ? cin : fin;
+
+    WindowHull window(blockSize);
+    vector<Point> hull;
+    vector<double> latency; // nanoseconds per update
+    long long lineNo = 0, skipped = 0;
+    string line;
+
+    auto start = chrono::steady_clock::now();
+    while (getline(in, line)) {
+        if (!line.empty() && line.back() == '\r') line.pop_back();
+        if (line.empty()) continue;
+        double t; Point p;
+        if (!parseSample(line, (double)lineNo++, t, p)) { skipped++; continue; }
+
+        auto t0 = chrono::steady_clock::now();
+        window.push(t, p);
+        if (byTime) {
+            while (window.size() > 1 && window.oldestTime() <= t - W) window.pop();
+        } else {
+            while ((double)window.size() > W) window.pop();
+        }
+        hull = window.hull();
+        auto t1 = chrono::steady_clock::now();
+        latency.push_back(chrono::duration<double, nano>(t1 - t0).count());
+    }
+    auto end = chrono::steady_clock::now();
+    double total = chrono::duration<double>(end - start).count();
+
+    sort(latency.begin(), latency.end());
+    double busy = 0;
+    for (double l : latency) busy += l;
+    size_t updates = latency.size();
+
+    string base = filename == "-" ? string("stdin.txt") : filename;
+    string outFile = "Window_Results_" + base;
+    ofstream fout(outFile);
+    if (!fout) { cerr << "Failed to open " << outFile << " for writing\n"; return 1; }
+
+    for (ostream *os : {(ostream *)&cout, (ostream *)&fout}) {
+        *os << hull.size() << " point hull size.\n";
+        *os << "The Algorithm made " << op_counter << " operations.\n";
+        *os << "The size of the stream was " << updates << " (" << skipped << " lines skipped).\n";
+        *os << "Window: " << W << (byTime ? " seconds" : " points") << ", " << window.size()
+            << " points at end, blocks of " << blockSize << "\n";
+        *os << "Hull update time: " << busy / 1e9 << " seconds (" << total << " seconds with input)\n";
+        *os << "Update throughput: " << (busy > 0 ? updates / (busy / 1e9) : 0) << " updates/second\n";
+        *os << "Update latency (ns): p50 " << percentile(latency, 0.50)
+            << ", p90 " << percentile(latency, 0.90)
+            << ", p99 " << percentile(latency, 0.99)
+            << ", p99.9 " << percentile(latency, 0.999)
+            << ", max " << (latency.empty() ? 0 : latency.back()) << "\n";
+    }
+    fout << "The points in the convex hull are:\n";
+    for (auto &p : hull) fout << "(" << p.x << ", " << p.y << ")\n";
+    fout.close();
+    cout << "Results saved to: " << outFile << endl;
+    return 0;
+}